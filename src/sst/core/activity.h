@@ -244,6 +244,22 @@ private:
     };
     static std::mutex              poolMutex;
     static std::vector<PoolInfo_t> memPools;
+    // Options passed to each new MemPool, set from Config in main()
+    static bool                    memPoolReclaim;
+    static bool                    memPoolHugePages;
+
+    // Each thread keeps its pools in a table indexed by size class
+    // (size in multiples of 8 bytes), so finding the pool is a single
+    // lookup.  Sizes past the end of the table fall back to searching
+    // memPools.
+    static const size_t                numSizeClasses = 128;
+    static thread_local Core::MemPool* threadPools[numSizeClasses];
+
+    static inline size_t getSizeClass(std::size_t size) { return (size + 7) >> 3; }
+
+    /* Defined in event.cc */
+    static Core::MemPool* getMemPool(std::size_t size);
+    static void           freeRemote(Core::MemPool* pool, PoolData_t* ptr);
 
 public:
     /** Allocates memory from a memory pool for a new Activity */
@@ -254,23 +270,9 @@ public:
          * 2) Alloc item from pool
          * 3) Append PoolID to item, increment pointer
          */
-        Core::MemPool*  pool   = nullptr;
-        size_t          nPools = memPools.size();
-        std::thread::id tid    = std::this_thread::get_id();
-        for ( size_t i = 0; i < nPools; i++ ) {
-            PoolInfo_t& p = memPools[i];
-            if ( p.tid == tid && p.size == size ) {
-                pool = p.pool;
-                break;
-            }
-        }
-        if ( nullptr == pool ) {
-            /* Still can't find it, alloc a new one */
-            pool = new Core::MemPool(size + sizeof(PoolData_t));
-
-            std::lock_guard<std::mutex> lock(poolMutex);
-            memPools.emplace_back(tid, size, pool);
-        }
+        size_t         sizeClass = getSizeClass(size);
+        Core::MemPool* pool      = sizeClass < numSizeClasses ? threadPools[sizeClass] : nullptr;
+        if ( UNLIKELY(nullptr == pool) ) pool = getMemPool(size);
 
         PoolData_t* ptr = (PoolData_t*)pool->malloc();
         if ( !ptr ) {
@@ -293,21 +295,18 @@ public:
         Core::MemPool* pool = *ptr8;
         *ptr8               = nullptr;
 
-        pool->free(ptr8);
+        // Pools in this thread's table belong to this thread
+        size_t sizeClass = getSizeClass(pool->getElementSize() - sizeof(PoolData_t));
+        if ( LIKELY(sizeClass < numSizeClasses && threadPools[sizeClass] == pool) )
+            pool->freeLocal(ptr8);
+        else
+            freeRemote(pool, ptr8);
     }
-    void operator delete(void* ptr, std::size_t UNUSED(sz))
-    {
-        /* 1) Decrement pointer
-         * 2) Determine Pool Pointer
-         * 2b) Set Pointer field to nullptr to allow tracking
-         * 3) Return to pool
-         */
-        PoolData_t*    ptr8 = ((PoolData_t*)ptr) - 1;
-        Core::MemPool* pool = *ptr8;
-        *ptr8               = nullptr;
+    void operator delete(void* ptr, std::size_t UNUSED(sz)) { Activity::operator delete(ptr); }
 
-        pool->free(ptr8);
-    };
+    /** Hands back any elements this thread has freed but not yet
+     * returned to pools owned by other threads */
+    static void flushRemoteFrees();
 
     static void getMemPoolUsage(uint64_t& bytes, uint64_t& active_activities)
     {
@@ -319,13 +318,27 @@ public:
         }
     }
 
+    /** Sums the high-water mark, bytes in use (which together with
+     * the bytes reported by getMemPoolUsage gives the fragmentation)
+     * and bytes returned to the OS for all memory pools */
+    static void getMemPoolStats(uint64_t& high_water_bytes, uint64_t& bytes_in_use, uint64_t& bytes_reclaimed)
+    {
+        high_water_bytes = 0;
+        bytes_in_use     = 0;
+        bytes_reclaimed  = 0;
+        for ( auto&& entry : Activity::memPools ) {
+            high_water_bytes += entry.pool->getHighWaterBytes();
+            bytes_in_use += entry.pool->getBytesInUse();
+            bytes_reclaimed += entry.pool->getBytesReclaimed();
+        }
+    }
+
     static void printUndeletedActivities(const std::string& header, Output& out, SimTime_t before = MAX_SIMTIME_T)
     {
         for ( auto&& entry : Activity::memPools ) {
-            const std::list<uint8_t*>& arenas    = entry.pool->getArenas();
-            size_t                     arenaSize = entry.pool->getArenaSize();
-            size_t                     elemSize  = entry.pool->getElementSize();
-            size_t                     nelem     = arenaSize / elemSize;
+            const std::list<uint8_t*>& arenas   = entry.pool->getArenas();
+            size_t                     elemSize = entry.pool->getElementSize();
+            size_t                     nelem    = entry.pool->getElementsPerArena();
             for ( auto iter = arenas.begin(); iter != arenas.end(); ++iter ) {
                 for ( size_t j = 0; j < nelem; j++ ) {
                     PoolData_t* ptr = (PoolData_t*)((*iter) + (elemSize * j));
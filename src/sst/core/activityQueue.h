@@ -35,6 +35,16 @@ public:
     /** Returns the next activity */
     virtual Activity* front()                    = 0;
 
+    /** Insert count activities into the queue.  Same as calling
+     * insert() on each of them in order, but lets queues that need a
+     * lock take it only once for the whole batch.
+     */
+    virtual void insertBatch(Activity* const* activities, size_t count)
+    {
+        for ( size_t i = 0; i < count; ++i )
+            insert(activities[i]);
+    }
+
 private:
 };
 
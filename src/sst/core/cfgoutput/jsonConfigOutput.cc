@@ -83,7 +83,7 @@ to_json(json::ordered_json& j, SubCompWrapper const& comp_wrapper)
         j["subcomponents"].push_back(SubCompWrapper { scItr });
     }
 
-    for ( auto const& pair : comp->enabledStatNames ) {
+    for ( auto const& pair : comp->getEnabledStatNames() ) {
         j["statistics"].push_back(StatPair { pair, comp });
     }
 }
@@ -106,7 +106,7 @@ to_json(json::ordered_json& j, CompWrapper const& comp_wrapper)
         j["subcomponents"].push_back(SubCompWrapper { scItr });
     }
 
-    for ( auto const& pair : comp->enabledStatNames ) {
+    for ( auto const& pair : comp->getEnabledStatNames() ) {
         j["statistics"].push_back(StatPair { pair, comp });
     }
 
@@ -154,12 +154,21 @@ JSONConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
     outputJson["program_options"]["print-timing-info"]  = cfg->print_timing() ? "true" : "false";
     // Ignore stopAfter for now
     // outputJson["program_options"]["stopAfter"] = cfg->stopAfterSec();
-    outputJson["program_options"]["heartbeat-period"]   = cfg->heartbeatPeriod();
-    outputJson["program_options"]["timebase"]           = cfg->timeBase();
-    outputJson["program_options"]["partitioner"]        = cfg->partitioner();
-    outputJson["program_options"]["timeVortex"]         = cfg->timeVortex();
-    outputJson["program_options"]["interthread-links"]  = cfg->interthread_links() ? "true" : "false";
-    outputJson["program_options"]["output-prefix-core"] = cfg->output_core_prefix();
+    outputJson["program_options"]["heartbeat-period"]     = cfg->heartbeatPeriod();
+    outputJson["program_options"]["timebase"]             = cfg->timeBase();
+    outputJson["program_options"]["partitioner"]          = cfg->partitioner();
+    outputJson["program_options"]["partition-lookahead"]  = cfg->partition_lookahead();
+    outputJson["program_options"]["partition-weights"]    = cfg->partition_weights();
+    outputJson["program_options"]["timeVortex"]           = cfg->timeVortex();
+    outputJson["program_options"]["interthread-links"]    = cfg->interthread_links() ? "true" : "false";
+    outputJson["program_options"]["interthread-inbox"]    = cfg->interthread_inbox() ? "true" : "false";
+    outputJson["program_options"]["rank-sync-overlap"]    = cfg->rank_sync_overlap() ? "true" : "false";
+    outputJson["program_options"]["rank-sync-neighbor"]   = cfg->rank_sync_neighbor() ? "true" : "false";
+    outputJson["program_options"]["rank-sync-shmem"]      = cfg->rank_sync_shmem() ? "true" : "false";
+    outputJson["program_options"]["thread-sync-neighbor"] = cfg->thread_sync_neighbor() ? "true" : "false";
+    outputJson["program_options"]["thread-numa-binding"]  = cfg->thread_numa_binding() ? "true" : "false";
+    outputJson["program_options"]["barrier-mode"]         = cfg->barrier_mode();
+    outputJson["program_options"]["output-prefix-core"]   = cfg->output_core_prefix();
 
     // Put in the global param sets
     for ( const auto& set : getGlobalParamSetNames() ) {
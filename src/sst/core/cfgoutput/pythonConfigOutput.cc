@@ -87,7 +87,7 @@ PythonConfigGraphOutput::generateCommonComponent(const char* objName, const Conf
     }
     fprintf(outputFile, ")\n");
 
-    for ( auto& pair : comp->enabledStatNames ) {
+    for ( auto& pair : comp->getEnabledStatNames() ) {
         auto& name       = pair.first;
         auto* si         = comp->findStatistic(pair.second);
         char* esStatName = makeEscapeSafe(name.c_str());
@@ -233,10 +233,30 @@ PythonConfigGraphOutput::generate(const Config* cfg, ConfigGraph* graph)
     fprintf(outputFile, "sst.setProgramOption(\"heartbeat-period\", \"%s\")\n", cfg->heartbeatPeriod().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"timebase\", \"%s\")\n", cfg->timeBase().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"partitioner\", \"%s\")\n", cfg->partitioner().c_str());
+    fprintf(outputFile, "sst.setProgramOption(\"partition-lookahead\", \"%s\")\n", cfg->partition_lookahead().c_str());
+    fprintf(outputFile, "sst.setProgramOption(\"partition-weights\", \"%s\")\n", cfg->partition_weights().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"timeVortex\", \"%s\")\n", cfg->timeVortex().c_str());
     fprintf(
         outputFile, "sst.setProgramOption(\"interthread-links\", \"%s\")\n",
         cfg->interthread_links() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"interthread-inbox\", \"%s\")\n",
+        cfg->interthread_inbox() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"rank-sync-overlap\", \"%s\")\n",
+        cfg->rank_sync_overlap() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"rank-sync-neighbor\", \"%s\")\n",
+        cfg->rank_sync_neighbor() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"rank-sync-shmem\", \"%s\")\n", cfg->rank_sync_shmem() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"thread-sync-neighbor\", \"%s\")\n",
+        cfg->thread_sync_neighbor() ? "true" : "false");
+    fprintf(
+        outputFile, "sst.setProgramOption(\"thread-numa-binding\", \"%s\")\n",
+        cfg->thread_numa_binding() ? "true" : "false");
+    fprintf(outputFile, "sst.setProgramOption(\"barrier-mode\", \"%s\")\n", cfg->barrier_mode().c_str());
     fprintf(outputFile, "sst.setProgramOption(\"output-prefix-core\", \"%s\")\n", cfg->output_core_prefix().c_str());
 
     // Output the global params
@@ -91,10 +91,10 @@ ComponentInfo::ComponentInfo(
     component(nullptr),
     params(&ccomp->params),
     defaultTimeBase(nullptr),
-    statConfigs(&ccomp->statistics),
-    enabledStatNames(&ccomp->enabledStatNames),
+    statConfigs(ccomp->stats ? &ccomp->stats->statistics : nullptr),
+    enabledStatNames(ccomp->stats ? &ccomp->stats->enabledStatNames : nullptr),
     enabledAllStats(ccomp->enabledAllStats),
-    allStatConfig(&ccomp->allStatConfig),
+    allStatConfig(ccomp->getAllStatConfig()),
     statLoadLevel(ccomp->statLoadLevel),
     coordinates(ccomp->coords),
     subIDIndex(1),
@@ -138,6 +138,8 @@ ComponentInfo::ComponentInfo(ComponentInfo&& o) :
     params(o.params),
     defaultTimeBase(o.defaultTimeBase),
     statConfigs(o.statConfigs),
+    enabledStatNames(o.enabledStatNames),
+    enabledAllStats(o.enabledAllStats),
     allStatConfig(o.allStatConfig),
     statLoadLevel(o.statLoadLevel),
     coordinates(o.coordinates),
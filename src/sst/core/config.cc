@@ -17,6 +17,7 @@
 #include "sst/core/env/envquery.h"
 #include "sst/core/output.h"
 #include "sst/core/part/sstpart.h"
+#include "sst/core/unitAlgebra.h"
 #include "sst/core/warnmacros.h"
 
 #ifdef SST_CONFIG_HAVE_MPI
@@ -26,6 +27,7 @@ REENABLE_WARNING
 #endif
 
 #include <cstdlib>
+#include <cstring>
 #include <errno.h>
 #include <getopt.h>
 #include <iostream>
@@ -328,6 +330,13 @@ public:
         return true;
     }
 
+    // partition report
+    bool setPartitionReportFile(const std::string& arg)
+    {
+        cfg.partition_report_file_ = arg;
+        return true;
+    }
+
     // parallel load
 #ifdef SST_CONFIG_HAVE_MPI
     bool enableParallelLoadMode(const std::string& arg)
@@ -397,6 +406,136 @@ public:
         return success;
     }
 
+    // interthread inbox
+    bool setInterThreadInbox()
+    {
+        cfg.interthread_inbox_ = true;
+        return true;
+    }
+
+    bool setInterThreadInboxArg(const std::string& arg)
+    {
+        bool success           = false;
+        cfg.interthread_inbox_ = parseBoolean(arg, success, "interthread-inbox");
+        return success;
+    }
+
+    // rank sync overlap
+    bool setRankSyncOverlap()
+    {
+        cfg.rank_sync_overlap_ = true;
+        return true;
+    }
+
+    bool setRankSyncOverlapArg(const std::string& arg)
+    {
+        bool success           = false;
+        cfg.rank_sync_overlap_ = parseBoolean(arg, success, "rank-sync-overlap");
+        return success;
+    }
+
+    // rank sync with neighbors only
+    bool setRankSyncNeighbor()
+    {
+        cfg.rank_sync_neighbor_ = true;
+        return true;
+    }
+
+    bool setRankSyncNeighborArg(const std::string& arg)
+    {
+        bool success            = false;
+        cfg.rank_sync_neighbor_ = parseBoolean(arg, success, "rank-sync-neighbor");
+        return success;
+    }
+
+    // rank sync through shared memory
+    bool setRankSyncShmem()
+    {
+        cfg.rank_sync_shmem_ = true;
+        return true;
+    }
+
+    bool setRankSyncShmemArg(const std::string& arg)
+    {
+        bool success         = false;
+        cfg.rank_sync_shmem_ = parseBoolean(arg, success, "rank-sync-shmem");
+        return success;
+    }
+
+    // thread sync with neighboring threads only
+    bool setThreadSyncNeighbor()
+    {
+        cfg.thread_sync_neighbor_ = true;
+        return true;
+    }
+
+    bool setThreadSyncNeighborArg(const std::string& arg)
+    {
+        bool success              = false;
+        cfg.thread_sync_neighbor_ = parseBoolean(arg, success, "thread-sync-neighbor");
+        return success;
+    }
+
+    // bind threads to NUMA domains
+    bool setThreadNumaBinding()
+    {
+        cfg.thread_numa_binding_ = true;
+        return true;
+    }
+
+    bool setThreadNumaBindingArg(const std::string& arg)
+    {
+        bool success             = false;
+        cfg.thread_numa_binding_ = parseBoolean(arg, success, "thread-numa-binding");
+        return success;
+    }
+
+    // barrier mode
+    bool setBarrierMode(const std::string& arg)
+    {
+        if ( arg != "spin" && arg != "hybrid" ) {
+            fprintf(stderr, "Unknown option for --barrier-mode: %s\n", arg.c_str());
+            return false;
+        }
+        cfg.barrier_mode_ = arg;
+        return true;
+    }
+
+    // partition lookahead
+    bool setPartitionLookahead(const std::string& arg)
+    {
+        // An empty value is the default (search for the threshold) and
+        // is what --output-config writes when the option was not given
+        if ( arg.empty() ) {
+            cfg.partition_lookahead_ = arg;
+            return true;
+        }
+
+        // UnitAlgebra aborts on a string it can't parse, so check that
+        // this is a number followed by seconds with an SI prefix first
+        const char* start = arg.c_str();
+        char*       end   = nullptr;
+        strtod(start, &end);
+        std::string units(end);
+        units.erase(0, units.find_first_not_of(" \t"));
+        units.erase(units.find_last_not_of(" \t") + 1);
+        bool valid = end != start && !units.empty() && units.back() == 's' &&
+                     (units.size() == 1 || (units.size() == 2 && strchr("afpnumkKMGTPE", units[0]) != nullptr));
+        if ( !valid || !UnitAlgebra(arg).hasUnits("s") ) {
+            fprintf(stderr, "Failed to parse '%s' as a time (e.g. 10ns) for option --partition-lookahead\n", start);
+            return false;
+        }
+        cfg.partition_lookahead_ = arg;
+        return true;
+    }
+
+    // partition weights
+    bool setPartitionWeights(const std::string& arg)
+    {
+        cfg.partition_weights_ = arg;
+        return true;
+    }
+
     // debug file
     bool setDebugFile(const std::string& arg)
     {
@@ -460,6 +599,19 @@ public:
         cfg.event_dump_file_ = arg;
         return true;
     }
+
+    // mempool arena handling
+    bool enableMemPoolReclaim()
+    {
+        cfg.mempool_reclaim_ = true;
+        return true;
+    }
+
+    bool enableMemPoolHugePages()
+    {
+        cfg.mempool_huge_pages_ = true;
+        return true;
+    }
 #endif
 
     // rank sequentional startup
@@ -559,10 +711,20 @@ Config::print()
     std::cout << "dot_verbosity = " << dot_verbosity_ << std::endl;
     std::cout << "component_partition_file = " << component_partition_file_ << std::endl;
     std::cout << "output_partition = " << output_partition_ << std::endl;
+    std::cout << "partition_report_file = " << partition_report_file_ << std::endl;
     std::cout << "timeBase = " << timeBase_ << std::endl;
     std::cout << "parallel_load = " << parallel_load_ << std::endl;
     std::cout << "timeVortex = " << timeVortex_ << std::endl;
     std::cout << "interthread_links = " << interthread_links_ << std::endl;
+    std::cout << "interthread_inbox = " << interthread_inbox_ << std::endl;
+    std::cout << "rank_sync_overlap = " << rank_sync_overlap_ << std::endl;
+    std::cout << "rank_sync_neighbor = " << rank_sync_neighbor_ << std::endl;
+    std::cout << "rank_sync_shmem = " << rank_sync_shmem_ << std::endl;
+    std::cout << "thread_sync_neighbor = " << thread_sync_neighbor_ << std::endl;
+    std::cout << "thread_numa_binding = " << thread_numa_binding_ << std::endl;
+    std::cout << "barrier_mode = " << barrier_mode_ << std::endl;
+    std::cout << "partition_lookahead = " << partition_lookahead_ << std::endl;
+    std::cout << "partition_weights = " << partition_weights_ << std::endl;
     std::cout << "debugFile = " << debugFile_ << std::endl;
     std::cout << "libpath = " << libpath_ << std::endl;
     std::cout << "addLlibPath = " << addLibPath_ << std::endl;
@@ -571,6 +733,8 @@ Config::print()
     std::cout << "runMode = " << runMode_ << std::endl;
 #ifdef USE_MEMPOOL
     std::cout << "event_dump_file = " << event_dump_file_ << std::endl;
+    std::cout << "mempool_reclaim = " << mempool_reclaim_ << std::endl;
+    std::cout << "mempool_huge_pages = " << mempool_huge_pages_ << std::endl;
 #endif
     std::cout << "rank_seq_startup_ " << rank_seq_startup_ << std::endl;
     std::cout << "print_env" << print_env_ << std::endl;
@@ -615,6 +779,7 @@ Config::Config(RankInfo rank_info) : Config()
     dot_verbosity_            = 0;
     component_partition_file_ = "";
     output_partition_         = false;
+    partition_report_file_    = "";
 
     // Advance Options
     timeBase_                 = "1 ps";
@@ -622,6 +787,15 @@ Config::Config(RankInfo rank_info) : Config()
     parallel_load_mode_multi_ = true;
     timeVortex_               = "sst.timevortex.priority_queue";
     interthread_links_        = false;
+    interthread_inbox_        = false;
+    rank_sync_overlap_        = false;
+    rank_sync_neighbor_       = false;
+    rank_sync_shmem_          = false;
+    thread_sync_neighbor_     = false;
+    thread_numa_binding_      = false;
+    barrier_mode_             = "spin";
+    partition_lookahead_      = "";
+    partition_weights_        = "";
     debugFile_                = "/dev/null";
     libpath_                  = SST_INSTALL_PREFIX "/lib/sst";
     addLibPath_               = "";
@@ -634,6 +808,10 @@ Config::Config(RankInfo rank_info) : Config()
     runMode_ = Simulation::BOTH;
 #ifdef __SST_DEBUG_EVENT_TRACKING__
     event_dump_file_ = "";
+#endif
+#ifdef USE_MEMPOOL
+    mempool_reclaim_    = false;
+    mempool_huge_pages_ = false;
 #endif
     rank_seq_startup_ = false;
 
@@ -875,6 +1053,12 @@ static const struct sstLongOpts_s sstOptions[] = {
         "File to write SST component partitioning information.  When used without an argument and in conjuction with "
         "--output-json or --output-config options, will cause paritition information to be added to graph output.",
         &ConfigHelper::setWritePartition, &ConfigHelper::setWritePartitionFile, true),
+    DEF_ARG(
+        "output-partition-report", 0, "FILE",
+        "File to write a JSON report on the quality of the partition: the components and weight on each rank and "
+        "thread, the cut links and their latencies, and the predicted syncs per simulated second.  A summary is also "
+        "printed.",
+        &ConfigHelper::setPartitionReportFile, true),
 
     /* Advanced Features */
     DEF_SECTION_HEADING("Advanced Options"),
@@ -891,11 +1075,61 @@ static const struct sstLongOpts_s sstOptions[] = {
         &ConfigHelper::enableParallelLoad, &ConfigHelper::enableParallelLoadMode, false),
 #endif
     DEF_ARG(
-        "timeVortex", 0, "MODULE", "Select TimeVortex implementation <lib.timevortex>", &ConfigHelper::setTimeVortex,
-        true),
+        "timeVortex", 0, "MODULE",
+        "Select TimeVortex implementation <lib.timevortex>.  Params can be passed to it with the format "
+        "lib.timevortex(key=value,key=value,...)",
+        &ConfigHelper::setTimeVortex, true),
     DEF_FLAG_OPTVAL(
         "interthread-links", 0, "[EXPERIMENTAL] Set whether or not interthread links should be used <false>",
         &ConfigHelper::setInterThreadLinks, &ConfigHelper::setInterThreadLinksArg, true),
+    DEF_FLAG_OPTVAL(
+        "interthread-inbox", 0,
+        "[EXPERIMENTAL] Deliver events on interthread links through per-thread lock-free inboxes instead of a locked "
+        "TimeVortex.  Only used with --interthread-links <false>",
+        &ConfigHelper::setInterThreadInbox, &ConfigHelper::setInterThreadInboxArg, true),
+    DEF_FLAG_OPTVAL(
+        "rank-sync-overlap", 0,
+        "[EXPERIMENTAL] Let ranks keep executing while the events exchanged at a sync are in flight.  Syncs happen "
+        "twice as often, but no rank waits on MPI unless its neighbors fall behind <false>",
+        &ConfigHelper::setRankSyncOverlap, &ConfigHelper::setRankSyncOverlapArg, true),
+    DEF_FLAG_OPTVAL(
+        "rank-sync-neighbor", 0,
+        "[EXPERIMENTAL] Sync each rank only with the ranks it has links to, using the latency of those links instead "
+        "of the global minimum partition latency.  Can't be used with --rank-sync-overlap or --heartbeat-period "
+        "<false>",
+        &ConfigHelper::setRankSyncNeighbor, &ConfigHelper::setRankSyncNeighborArg, true),
+    DEF_FLAG_OPTVAL(
+        "rank-sync-shmem", 0,
+        "[EXPERIMENTAL] Exchange rank sync data with ranks on the same node through shared memory instead of MPI.  "
+        "Can't be used with the other --rank-sync options <false>",
+        &ConfigHelper::setRankSyncShmem, &ConfigHelper::setRankSyncShmemArg, true),
+    DEF_FLAG_OPTVAL(
+        "thread-sync-neighbor", 0,
+        "[EXPERIMENTAL] Sync each thread only with the threads it has links to, using the latency of those links as "
+        "the lookahead, instead of stopping all threads at every sync.  Only used with a single rank and can't be "
+        "used with --interthread-links <false>",
+        &ConfigHelper::setThreadSyncNeighbor, &ConfigHelper::setThreadSyncNeighborArg, true),
+    DEF_FLAG_OPTVAL(
+        "thread-numa-binding", 0,
+        "[EXPERIMENTAL] Bind the threads of each rank, in equal blocks and in order, to the CPUs of the NUMA domains "
+        "the rank may run on.  This is the thread layout the sst.hierarchical partitioner assumes (Linux only) <false>",
+        &ConfigHelper::setThreadNumaBinding, &ConfigHelper::setThreadNumaBindingArg, true),
+    DEF_ARG(
+        "barrier-mode", 0, "MODE",
+        "[EXPERIMENTAL] How threads wait at barriers [ spin (default) | hybrid ].  hybrid spins for a bounded, "
+        "adaptive time and then sleeps until released, which is better when threads are oversubscribed",
+        &ConfigHelper::setBarrierMode, true),
+    DEF_ARG(
+        "partition-lookahead", 0, "TIME",
+        "[EXPERIMENTAL] Smallest link latency the sst.lookahead partitioner may cut.  By default it finds the largest "
+        "latency that still allows a balanced partition",
+        &ConfigHelper::setPartitionLookahead, true),
+    DEF_ARG(
+        "partition-weights", 0, "FILES",
+        "[EXPERIMENTAL] Comma separated list of profile files from an earlier run with "
+        "--enable-profiling=\"event:sst.profile.handler.event.partition;clock:sst.profile.handler.clock.partition\".  "
+        "The measured handler times weight the components and the event counts weight the links for the partitioner",
+        &ConfigHelper::setPartitionWeights, true),
     DEF_ARG("debug-file", 0, "FILE", "File where debug output will go", &ConfigHelper::setDebugFile, true),
     DEF_ARG("lib-path", 0, "LIBPATH", "Component library path (overwrites default)", &ConfigHelper::setLibPath, true),
     DEF_ARG(
@@ -921,6 +1155,12 @@ static const struct sstLongOpts_s sstOptions[] = {
         "file to write information about all undeleted events at the end of simulation (STDOUT and STDERR can be used "
         "to output to console)",
         &ConfigHelper::setWriteUndeleted, true),
+    DEF_FLAG(
+        "mempool-reclaim", 0, "Return memory pool arenas to the OS once all the events in them have been deleted",
+        &ConfigHelper::enableMemPoolReclaim),
+    DEF_FLAG(
+        "mempool-huge-pages", 0, "Ask for memory pool arenas to be backed by transparent huge pages",
+        &ConfigHelper::enableMemPoolHugePages),
 #endif
     DEF_FLAG(
         "force-rank-seq-startup", 0,
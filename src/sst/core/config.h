@@ -195,6 +195,12 @@ public:
      */
     bool output_partition() const { return output_partition_; }
 
+    /**
+       File to write the partition quality report to as JSON (empty
+       string means no report)
+    */
+    const std::string& partition_report_file() const { return partition_report_file_; }
+
     // Advanced options
 
     /**
@@ -229,6 +235,62 @@ public:
     */
     bool interthread_links() const { return interthread_links_; }
 
+    /**
+       Use per-thread lock-free inboxes for events sent on interthread links
+    */
+    bool interthread_inbox() const { return interthread_inbox_; }
+
+    /**
+       Overlap the rank sync exchange with execution of the next sync
+       window
+    */
+    bool rank_sync_overlap() const { return rank_sync_overlap_; }
+
+    /**
+       Only sync each rank with the ranks it has links to, using the
+       latency of those links as the lookahead
+    */
+    bool rank_sync_neighbor() const { return rank_sync_neighbor_; }
+
+    /**
+       Move rank sync data between ranks on the same node through
+       shared memory
+    */
+    bool rank_sync_shmem() const { return rank_sync_shmem_; }
+
+    /**
+       Only sync each thread with the threads it has links to, instead
+       of holding all threads together at every sync
+    */
+    bool thread_sync_neighbor() const { return thread_sync_neighbor_; }
+
+    /**
+       Bind each thread to the CPUs of its NUMA domain, using the
+       layout the sst.hierarchical partitioner assumes
+    */
+    bool thread_numa_binding() const { return thread_numa_binding_; }
+
+    /**
+       How threads wait at the simulation and thread sync barriers:
+       spin (default) or hybrid (bounded spin, then sleep)
+    */
+    const std::string& barrier_mode() const { return barrier_mode_; }
+
+    /**
+       Smallest link latency the sst.lookahead partitioner may cut.
+       Empty to find the largest one that still allows a balanced
+       partition.
+    */
+    const std::string& partition_lookahead() const { return partition_lookahead_; }
+
+    /**
+       Comma separated list of profile files, written by the
+       profile.handler.*.partition profile tools in an earlier run, used
+       to weight the components and links for partitioning.  Empty for
+       no weighting.
+    */
+    const std::string& partition_weights() const { return partition_weights_; }
+
     /**
        File to which core debug information should be written
     */
@@ -274,6 +336,17 @@ public:
        of the simulation.
     */
     const std::string& event_dump_file() const { return event_dump_file_; }
+
+    /**
+       Return memory pool arenas to the OS once they are completely
+       free
+    */
+    bool mempool_reclaim() const { return mempool_reclaim_; }
+
+    /**
+       Back memory pool arenas with transparent huge pages
+    */
+    bool mempool_huge_pages() const { return mempool_huge_pages_; }
 #endif
 
     /**
@@ -328,18 +401,32 @@ public:
         ser& dot_verbosity_;
         ser& component_partition_file_;
         ser& output_partition_;
+        ser& partition_report_file_;
 
         ser& timeBase_;
         ser& parallel_load_;
         ser& parallel_load_mode_multi_;
         ser& timeVortex_;
         ser& interthread_links_;
+        ser& interthread_inbox_;
+        ser& rank_sync_overlap_;
+        ser& rank_sync_neighbor_;
+        ser& rank_sync_shmem_;
+        ser& thread_sync_neighbor_;
+        ser& thread_numa_binding_;
+        ser& barrier_mode_;
+        ser& partition_lookahead_;
+        ser& partition_weights_;
         ser& debugFile_;
         ser& libpath_;
         ser& addLibPath_;
         ser& enabled_profiling_;
         ser& profiling_output_;
         ser& runMode_;
+#ifdef USE_MEMPOOL
+        ser& mempool_reclaim_;
+        ser& mempool_huge_pages_;
+#endif
 
         ser& print_env_;
         ser& enable_sig_handling_;
@@ -398,6 +485,7 @@ private:
     uint32_t    dot_verbosity_;            /*!< Amount of detail to include in the dot graph output */
     std::string component_partition_file_; /*!< File to dump component graph */
     bool        output_partition_;         /*!< Output paritition info when writing config output */
+    std::string partition_report_file_;    /*!< File to write partition quality report */
 
     // Advanced options
     std::string timeBase_;                 /*!< Timebase of simulation */
@@ -405,6 +493,15 @@ private:
     bool        parallel_load_mode_multi_; /*!< If true, load using multiple files */
     std::string timeVortex_;               /*!< TimeVortex implementation to use */
     bool        interthread_links_;        /*!< Use interthread links */
+    bool        interthread_inbox_;        /*!< Use lock-free inboxes for interthread links */
+    bool        rank_sync_overlap_;        /*!< Overlap rank sync communication with execution */
+    bool        rank_sync_neighbor_;       /*!< Sync ranks with their neighbors only */
+    bool        rank_sync_shmem_;          /*!< Use shared memory for rank sync data within a node */
+    bool        thread_sync_neighbor_;     /*!< Only sync threads with the threads they have links to */
+    bool        thread_numa_binding_;      /*!< Bind threads to the CPUs of their NUMA domain */
+    std::string barrier_mode_;             /*!< How threads wait at barriers (spin or hybrid) */
+    std::string partition_lookahead_;      /*!< Smallest link latency the lookahead partitioner may cut */
+    std::string partition_weights_;        /*!< Profile files to weight the partition with */
     std::string debugFile_;                /*!< File to which debug information should be written */
     std::string libpath_;
     std::string addLibPath_;
@@ -416,7 +513,9 @@ private:
     // Advanced options - debug
     Simulation::Mode_t runMode_; /*!< Run Mode (Init, Both, Run-only) */
 #ifdef USE_MEMPOOL
-    std::string event_dump_file_; /*!< File to dump undeleted events to */
+    std::string event_dump_file_;    /*!< File to dump undeleted events to */
+    bool        mempool_reclaim_;    /*!< Unmap memory pool arenas once they are free */
+    bool        mempool_huge_pages_; /*!< Use huge pages for memory pool arenas */
 #endif
     bool rank_seq_startup_; /*!< Run simulation initialization phases one rank at a time */
 
@@ -23,6 +23,7 @@
 
 #include <algorithm>
 #include <fstream>
+#include <sstream>
 #include <string.h>
 
 using namespace std;
@@ -72,6 +73,40 @@ checkForValidLinkName(const std::string& name)
 
 namespace SST {
 
+const std::string                         ConfigString::empty_string;
+std::unordered_map<std::string, uint32_t> ConfigString::index_map;
+std::vector<const std::string*>           ConfigString::table;
+
+uint32_t
+ConfigString::intern(const std::string& str)
+{
+    if ( str.empty() ) return 0;
+    auto ret = index_map.emplace(str, table.size() + 1);
+    if ( ret.second ) table.push_back(&ret.first->first);
+    return ret.first->second;
+}
+
+std::vector<std::string>
+ConfigString::getTable()
+{
+    std::vector<std::string> strings;
+    strings.reserve(table.size());
+    for ( auto* str : table ) {
+        strings.push_back(*str);
+    }
+    return strings;
+}
+
+void
+ConfigString::setTable(const std::vector<std::string>& strings)
+{
+    index_map.clear();
+    table.clear();
+    for ( auto& str : strings ) {
+        intern(str);
+    }
+}
+
 void
 ConfigLink::updateLatencies(TimeLord* timeLord)
 {
@@ -186,13 +221,12 @@ ConfigComponent::print(std::ostream& os) const
     os << "  statLoadLevel = " << (uint32_t)statLoadLevel << std::endl;
     os << "  enabledAllStats = " << enabledAllStats << std::endl;
     os << "    Params:" << std::endl;
-    allStatConfig.params.print_all_params(os, "      ");
+    if ( stats ) stats->allStatConfig.params.print_all_params(os, "      ");
     os << "  Statistics:" << std::endl;
-    for ( auto& pair : enabledStatNames ) {
+    for ( auto& pair : getEnabledStatNames() ) {
         os << "    " << pair.first << std::endl;
         os << "      Params:" << std::endl;
-        auto iter = statistics.find(pair.second);
-        iter->second.params.print_all_params(os, "      ");
+        findStatistic(pair.second)->params.print_all_params(os, "      ");
     }
     os << "  SubComponents:\n";
     for ( auto* sc : subComponents ) {
@@ -212,10 +246,8 @@ ConfigComponent::cloneWithoutLinks(ConfigGraph* new_graph) const
     ret->rank             = rank;
     ret->params           = params;
     ret->statLoadLevel    = statLoadLevel;
-    ret->statistics       = statistics;
-    ret->enabledStatNames = enabledStatNames;
     ret->enabledAllStats  = enabledAllStats;
-    ret->allStatConfig    = allStatConfig;
+    ret->stats            = stats ? new ConfigComponentStatistics(*stats) : nullptr;
     ret->coords           = coords;
     ret->nextSubID        = nextSubID;
     ret->graph            = new_graph;
@@ -271,6 +303,26 @@ ConfigComponent::getNextSubComponentID()
     }
 }
 
+ConfigComponentStatistics*
+ConfigComponent::getStats()
+{
+    if ( !stats ) stats = new ConfigComponentStatistics();
+    return stats;
+}
+
+const std::map<std::string, StatisticId_t>&
+ConfigComponent::getEnabledStatNames() const
+{
+    static const std::map<std::string, StatisticId_t> none;
+    return stats ? stats->enabledStatNames : none;
+}
+
+ConfigStatistic*
+ConfigComponent::getAllStatConfig() const
+{
+    return stats ? &stats->allStatConfig : nullptr;
+}
+
 StatisticId_t
 ConfigComponent::getNextStatisticID()
 {
@@ -344,7 +396,7 @@ ConfigComponent::createStatistic()
     ConfigStatistic* cs     = nullptr;
     if ( parent ) { cs = parent->insertStatistic(stat_id); }
     else {
-        cs = &statistics[stat_id];
+        cs = &getStats()->statistics[stat_id];
     }
     cs->id = stat_id;
     return cs;
@@ -365,16 +417,16 @@ ConfigComponent::enableStatistic(const std::string& statisticName, const SST::Pa
     if ( statisticName == STATALLFLAG ) {
         // Special sentinel id for enable all
         // The ConfigStatistic object for STATALLFLAG is not an entry of the statistics
-        // It has its own ConfigStatistic as a member variable of ConfigComponent which must be used
+        // It has its own ConfigStatistic in the component's ConfigComponentStatistics which must be used
         // in case of enabledAllStats == true.
-        enabledAllStats  = true;
-        allStatConfig.id = STATALL_ID;
-        allStatConfig.params.insert(params);
-        return &allStatConfig;
+        enabledAllStats = true;
+        getStats()->allStatConfig.params.insert(params);
+        return &stats->allStatConfig;
     }
     else {
         // this is a valid statistic
-        auto iter = enabledStatNames.find(statisticName);
+        auto& enabledStatNames = getStats()->enabledStatNames;
+        auto  iter             = enabledStatNames.find(statisticName);
         if ( iter == enabledStatNames.end() ) {
             // this is the first time being enabled
             stat_id                         = getNextStatisticID();
@@ -393,7 +445,7 @@ ConfigComponent::enableStatistic(const std::string& statisticName, const SST::Pa
         }
     }
 
-    ConfigStatistic& cs = statistics[stat_id];
+    ConfigStatistic& cs = stats->statistics[stat_id];
     cs.id               = stat_id;
     cs.params.insert(params);
     return &cs;
@@ -418,13 +470,12 @@ ConfigComponent::reuseStatistic(const std::string& statisticName, StatisticId_t
         return false;
     }
 
-    auto iter = comp->statistics.find(sid);
-    if ( iter == comp->statistics.end() ) {
+    if ( !comp->stats || comp->stats->statistics.find(sid) == comp->stats->statistics.end() ) {
         Output::getDefaultObject().fatal(CALL_INFO, 1, "Cannot reuse a statistic that doesn't exist for the parent");
         return false;
     }
     else {
-        enabledStatNames[statisticName] = sid;
+        getStats()->enabledStatNames[statisticName] = sid;
         return true;
     }
 }
@@ -443,7 +494,7 @@ ConfigComponent::addStatisticParameter(
     }
 
     ConfigStatistic* cs = nullptr;
-    if ( statisticName == STATALLFLAG ) { cs = &allStatConfig; }
+    if ( statisticName == STATALLFLAG ) { cs = &getStats()->allStatConfig; }
     else {
         cs = findStatistic(statisticName);
     }
@@ -464,7 +515,7 @@ ConfigComponent::setStatisticParameters(const std::string& statisticName, const
     }
 
     if ( statisticName == STATALLFLAG ) {
-        allStatConfig.params.insert(params);
+        getStats()->allStatConfig.params.insert(params);
         ;
     }
     else {
@@ -562,14 +613,15 @@ ConfigComponent::insertStatistic(StatisticId_t sid)
     ConfigComponent* parent = getParent();
     if ( parent ) { return parent->insertStatistic(sid); }
     else {
-        return &statistics[sid];
+        return &getStats()->statistics[sid];
     }
 }
 
 ConfigStatistic*
 ConfigComponent::findStatistic(const std::string& name) const
 {
-    auto iter = enabledStatNames.find(name);
+    auto& enabledStatNames = getEnabledStatNames();
+    auto  iter             = enabledStatNames.find(name);
     if ( iter != enabledStatNames.end() ) {
         StatisticId_t id = iter->second;
         return findStatistic(id);
@@ -584,9 +636,12 @@ ConfigComponent::findStatistic(StatisticId_t sid) const
 {
     auto* parent = getParent();
     if ( parent ) { return parent->findStatistic(sid); }
+    else if ( !stats ) {
+        return nullptr;
+    }
     else {
-        auto iter = statistics.find(sid);
-        if ( iter == statistics.end() ) { return nullptr; }
+        auto iter = stats->statistics.find(sid);
+        if ( iter == stats->statistics.end() ) { return nullptr; }
         else {
             // I hate that I have to do this
             return const_cast<ConfigStatistic*>(&iter->second);
@@ -748,6 +803,97 @@ ConfigGraph::checkForStructuralErrors()
     return found_error;
 }
 
+bool
+ConfigGraph::readPartitionWeights(const std::string& files)
+{
+    // Handler time by top level component and events received by
+    // (sub)component and port, summed over all the files
+    std::map<ComponentId_t, double>                         comp_time;
+    std::map<std::pair<ComponentId_t, std::string>, double> port_count;
+    // Anonymous subcomponents use ports of the component that loaded
+    // them, which aren't in the graph, so also total them by top level
+    // component and port
+    std::map<std::pair<ComponentId_t, std::string>, double> anon_port_count;
+
+    std::stringstream file_list(files);
+    std::string       file;
+    while ( std::getline(file_list, file, ',') ) {
+        if ( file.empty() ) continue;
+        std::ifstream in(file);
+        if ( !in.is_open() ) {
+            output.output("ERROR: Unable to open partition weights file %s\n", file.c_str());
+            return false;
+        }
+
+        // Lines written by the partition profile tools start with the
+        // kind of entry; everything else is ignored
+        std::string line;
+        while ( std::getline(in, line) ) {
+            std::istringstream fields(line);
+            std::string        kind;
+            ComponentId_t      id;
+            fields >> kind;
+            if ( kind == "partition.component" ) {
+                double time;
+                if ( fields >> id >> time ) comp_time[id] += time;
+            }
+            else if ( kind == "partition.port" ) {
+                std::string port;
+                double      count;
+                if ( !(fields >> id >> port >> count) ) continue;
+                port_count[std::make_pair(id, port)] += count;
+                if ( COMPDEFINED_SUBCOMPONENT_ID_MASK(id) )
+                    anon_port_count[std::make_pair(COMPONENT_ID_MASK(id), port)] += count;
+            }
+        }
+    }
+
+    // Weights are relative to the mean, with a floor so that nothing
+    // that happened to be idle in the profile is free
+    const double min_weight = 0.01;
+
+    if ( !comp_time.empty() && comps.size() > 0 ) {
+        double total = 0;
+        for ( auto& x : comp_time ) {
+            total += x.second;
+        }
+        double mean = total / comps.size();
+        for ( ConfigComponent* comp : comps ) {
+            auto   found = comp_time.find(comp->id);
+            double time  = found == comp_time.end() ? 0 : found->second;
+            comp->weight = mean > 0 ? std::max(time / mean, min_weight) : 1.0;
+        }
+    }
+
+    if ( !port_count.empty() && links.size() > 0 ) {
+        std::vector<double> counts;
+        counts.reserve(links.size());
+        double total = 0;
+        for ( ConfigLink* link : links ) {
+            double count = 0;
+            for ( int i = 0; i < 2; i++ ) {
+                auto found = port_count.find(std::make_pair(link->component[i], link->port[i]));
+                if ( found != port_count.end() ) {
+                    count += found->second;
+                    continue;
+                }
+                found = anon_port_count.find(std::make_pair(COMPONENT_ID_MASK(link->component[i]), link->port[i]));
+                if ( found != anon_port_count.end() ) count += found->second;
+            }
+            counts.push_back(count);
+            total += count;
+        }
+        double mean = total / links.size();
+        size_t i    = 0;
+        for ( ConfigLink* link : links ) {
+            link->weight = mean > 0 ? std::max(counts[i] / mean, min_weight) : 1.0;
+            i++;
+        }
+    }
+
+    return true;
+}
+
 ComponentId_t
 ConfigGraph::addComponent(const std::string& name, const std::string& type)
 {
@@ -1256,6 +1402,9 @@ ConfigGraph::getCollapsedPartitionGraph()
             const ConfigComponent* comp = comps[*i];
             // Compute the new weight
             pcomp->weight += comp->weight;
+            for ( size_t d = 0; d < 3; d++ ) {
+                pcomp->coords[d] += comp->coords[d] / group.size();
+            }
             // Inserting in order because the iterator is from an
             // ordered set
             pcomp->group.insert(*i);
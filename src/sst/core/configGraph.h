@@ -26,6 +26,7 @@
 #include <climits>
 #include <map>
 #include <set>
+#include <unordered_map>
 #include <vector>
 
 using namespace SST::Statistics;
@@ -41,6 +42,77 @@ class ConfigGraph;
 typedef SparseVectorMap<ComponentId_t> ComponentIdMap_t;
 typedef std::vector<LinkId_t>          LinkIdMap_t;
 
+/**
+   A string stored once in a table shared by every ConfigGraph, for the
+   type names, port names and latencies that repeat across many
+   components and links.  Each use costs only an index into the table.
+
+   Like the Params key map, the table is global and only the index is
+   serialized, so the table must be broadcast (see getTable() and
+   setTable()) before any graph is sent between ranks.  Strings are
+   only added while the graph is built, which is single threaded.
+*/
+class ConfigString
+{
+public:
+    ConfigString() : index(0) {}
+    ConfigString(const std::string& str) : index(intern(str)) {}
+    ConfigString(const char* str) : index(intern(str)) {}
+
+    ConfigString& operator=(const std::string& str)
+    {
+        index = intern(str);
+        return *this;
+    }
+
+    const std::string& str() const { return index == 0 ? empty_string : *table[index - 1]; }
+    const char*        c_str() const { return str().c_str(); }
+    bool               empty() const { return index == 0; }
+    operator const std::string&() const { return str(); }
+
+    bool operator==(const ConfigString& other) const { return index == other.index; }
+    bool operator!=(const ConfigString& other) const { return index != other.index; }
+    bool operator<(const ConfigString& other) const { return str() < other.str(); }
+
+    /** Get the strings in the table, in index order */
+    static std::vector<std::string> getTable();
+    /** Replace the table with one from getTable() on another rank */
+    static void                     setTable(const std::vector<std::string>& strings);
+
+private:
+    friend class SST::Core::Serialization::serialize<ConfigString>;
+
+    static uint32_t intern(const std::string& str);
+
+    // 0 is the empty string, otherwise one more than the position in
+    // table
+    uint32_t index;
+
+    static const std::string                         empty_string;
+    static std::unordered_map<std::string, uint32_t> index_map;
+    // Points at the keys of index_map, which don't move
+    static std::vector<const std::string*>           table;
+};
+
+inline std::ostream&
+operator<<(std::ostream& os, const ConfigString& str)
+{
+    return os << str.str();
+}
+
+namespace Core {
+namespace Serialization {
+
+template <>
+class serialize<SST::ConfigString>
+{
+public:
+    void operator()(SST::ConfigString& str, serializer& ser) { ser& str.index; }
+};
+
+} // namespace Serialization
+} // namespace Core
+
 /** Represents the configuration of a generic Link */
 class ConfigLink : public SST::Core::Serialization::serializable
 {
@@ -48,13 +120,14 @@ public:
     LinkId_t      id;             /*!< ID of this link */
     std::string   name;           /*!< Name of this link */
     ComponentId_t component[2];   /*!< IDs of the connected components */
-    std::string   port[2];        /*!< Names of the connected ports */
+    ConfigString  port[2];        /*!< Names of the connected ports */
     SimTime_t     latency[2];     /*!< Latency from each side */
-    std::string   latency_str[2]; /*!< Temp string holding latency */
+    ConfigString  latency_str[2]; /*!< Temp string holding latency */
 
     LinkId_t order;  /*!< Number of components currently referring to this Link.  After graph construction, it will
                        be repurposed to hold the enforce_order value */
     bool     no_cut; /*!< If set to true, partitioner will not make a cut through this Link */
+    float    weight; /*!< Cost of cutting this Link, for partitioners that use it */
 
     // inline const std::string& key() const { return name; }
     inline LinkId_t key() const { return id; }
@@ -100,7 +173,7 @@ public:
 
 private:
     friend class ConfigGraph;
-    ConfigLink(LinkId_t id) : id(id), no_cut(false)
+    ConfigLink(LinkId_t id) : id(id), no_cut(false), weight(1.0)
     {
         order = 0;
 
@@ -109,7 +182,7 @@ private:
         component[1] = ULONG_MAX;
     }
 
-    ConfigLink(LinkId_t id, const std::string& n) : id(id), no_cut(false)
+    ConfigLink(LinkId_t id, const std::string& n) : id(id), no_cut(false), weight(1.0)
     {
         order = 0;
         name  = n;
@@ -213,6 +286,30 @@ public:
 
 typedef SparseVectorMap<LinkId_t, ConfigLink*> ConfigLinkMap_t;
 
+/**
+   The statistics enabled on a component.  Most components in a large
+   model enable none, so ConfigComponent only allocates these when a
+   statistic is enabled.
+*/
+class ConfigComponentStatistics : public SST::Core::Serialization::serializable
+{
+public:
+    std::map<std::string, StatisticId_t>     enabledStatNames;
+    std::map<StatisticId_t, ConfigStatistic> statistics; /*!< Only filled in for the top level component */
+    ConfigStatistic                          allStatConfig;
+
+    ConfigComponentStatistics() : allStatConfig(STATALL_ID) {}
+
+    void serialize_order(SST::Core::Serialization::serializer& ser) override
+    {
+        ser& enabledStatNames;
+        ser& statistics;
+        ser& allStatConfig;
+    }
+
+    ImplementSerializable(SST::ConfigComponentStatistics)
+};
+
 /** Represents the configuration of a generic component */
 class ConfigComponent : public SST::Core::Serialization::serializable
 {
@@ -223,7 +320,7 @@ public:
     ConfigGraph*          graph;         /*!< Graph that this component belongs to */
     std::string           name;          /*!< Name of this component, or slot name for subcomp */
     int                   slot_num;      /*!< Slot number.  Only valid for subcomponents */
-    std::string           type;          /*!< Type of this component */
+    ConfigString          type;          /*!< Type of this component */
     float                 weight;        /*!< Partitioning weight for this component */
     RankInfo              rank;          /*!< Parallel Rank for this component */
     std::vector<LinkId_t> links;         /*!< List of links connected */
@@ -231,9 +328,7 @@ public:
     uint8_t               statLoadLevel; /*!< Statistic load level for this component */
     // std::vector<ConfigStatistic>  enabledStatistics; /*!< List of subcomponents */
 
-    std::map<std::string, StatisticId_t> enabledStatNames;
-    bool                                 enabledAllStats;
-    ConfigStatistic                      allStatConfig;
+    bool enabledAllStats;
 
     std::vector<ConfigComponent*> subComponents; /*!< List of subcomponents */
     std::vector<double>           coords;
@@ -252,15 +347,19 @@ public:
     ConfigComponent* cloneWithoutLinksOrParams(ConfigGraph* new_graph) const;
     void             setConfigGraphPointer(ConfigGraph* graph_ptr);
 
-    ~ConfigComponent() {}
+    ~ConfigComponent() { delete stats; }
     ConfigComponent() :
         id(null_id),
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
         nextSubID(1),
-        visited(false)
+        visited(false),
+        stats(nullptr)
     {}
 
+    ConfigComponent(const ConfigComponent&) = delete;
+    ConfigComponent& operator=(const ConfigComponent&) = delete;
+
     StatisticId_t getNextStatisticID();
 
     ConfigComponent* getParent() const;
@@ -277,6 +376,9 @@ public:
     ConfigStatistic*       findStatistic(const std::string& name) const;
     ConfigStatistic*       insertStatistic(StatisticId_t id);
     ConfigStatistic*       findStatistic(StatisticId_t) const;
+    const std::map<std::string, StatisticId_t>& getEnabledStatNames() const;
+    /** Settings for enabling all statistics, nullptr if none were set */
+    ConfigStatistic*                            getAllStatConfig() const;
     ConfigStatistic*
     enableStatistic(const std::string& statisticName, const SST::Params& params, bool recursively = false);
     ConfigStatistic* createStatistic();
@@ -308,11 +410,8 @@ public:
         ser& rank.thread;
         ser& links;
         ser& params;
-        ser& enabledStatNames;
-        ser& enabledAllStats;
-        ser& statistics;
         ser& enabledAllStats;
-        ser& allStatConfig;
+        ser& stats;
         ser& statLoadLevel;
         ser& subComponents;
         ser& coords;
@@ -323,10 +422,13 @@ public:
     ImplementSerializable(SST::ConfigComponent)
 
 private:
-    std::map<StatisticId_t, ConfigStatistic> statistics;
+    ConfigComponentStatistics* stats; /*!< Statistic settings, nullptr until used */
 
     ComponentId_t getNextSubComponentID();
 
+    /** Get the statistic settings, creating them if needed */
+    ConfigComponentStatistics* getStats();
+
     friend class ConfigGraph;
     /** Checks to make sure port names are valid and that a port isn't used twice
      */
@@ -345,7 +447,8 @@ private:
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
         nextSubID(1),
-        nextStatID(1)
+        nextStatID(1),
+        stats(nullptr)
     {
         coords.resize(3, 0.0);
     }
@@ -363,7 +466,8 @@ private:
         statLoadLevel(STATISTICLOADLEVELUNINITIALIZED),
         enabledAllStats(false),
         nextSubID(parent_subid),
-        nextStatID(parent_subid)
+        nextStatID(parent_subid),
+        stats(nullptr)
     {
         coords.resize(3, 0.0);
     }
@@ -458,6 +562,11 @@ public:
     /** Check the graph for Structural errors */
     bool checkForStructuralErrors();
 
+    /** Set the component and link weights from the partition profile
+     * files (comma separated) written by an earlier run.  Returns false
+     * if a file can't be read. */
+    bool readPartitionWeights(const std::string& files);
+
     // Temporary until we have a better API
     /** Return the map of components */
     ConfigComponentMap_t& getComponentMap() { return comps; }
@@ -550,10 +659,11 @@ private:
 class PartitionComponent
 {
 public:
-    ComponentId_t id;
-    float         weight;
-    RankInfo      rank;
-    LinkIdMap_t   links;
+    ComponentId_t       id;
+    float               weight;
+    RankInfo            rank;
+    LinkIdMap_t         links;
+    std::vector<double> coords; /*!< Coordinates, averaged over the group */
 
     ComponentIdMap_t group;
 
@@ -562,9 +672,15 @@ public:
         id     = cc->id;
         weight = cc->weight;
         rank   = cc->rank;
+        coords = cc->coords;
     }
 
-    PartitionComponent(LinkId_t id) : id(id), weight(0), rank(RankInfo(RankInfo::UNASSIGNED, 0)) {}
+    PartitionComponent(LinkId_t id) :
+        id(id),
+        weight(0),
+        rank(RankInfo(RankInfo::UNASSIGNED, 0)),
+        coords(3, 0.0)
+    {}
 
     // PartitionComponent(ComponentId_t id, ConfigGraph* graph, const ComponentIdMap_t& group);
     void print(std::ostream& os, const PartitionGraph* graph) const;
@@ -579,6 +695,7 @@ public:
     ComponentId_t component[2];
     SimTime_t     latency[2];
     bool          no_cut;
+    float         weight;
 
     PartitionLink(const ConfigLink& cl)
     {
@@ -588,6 +705,7 @@ public:
         latency[0]   = cl.latency[0];
         latency[1]   = cl.latency[1];
         no_cut       = cl.no_cut;
+        weight       = cl.weight;
     }
 
     inline LinkId_t key() const { return id; }
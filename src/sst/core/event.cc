@@ -50,6 +50,106 @@ Event::generateUniqueId()
 #ifdef USE_MEMPOOL
 std::mutex                        Activity::poolMutex;
 std::vector<Activity::PoolInfo_t> Activity::memPools;
+bool                              Activity::memPoolReclaim   = false;
+bool                              Activity::memPoolHugePages = false;
+thread_local Core::MemPool*       Activity::threadPools[Activity::numSizeClasses];
+
+namespace {
+
+// Elements freed by this thread that belong to pools owned by other
+// threads.  They are handed back a batch at a time, so the owning
+// pool's lock is taken once per batch rather than once per element.
+class RemoteFreeList
+{
+public:
+    static const size_t batch_size = 64;
+
+    struct Batch
+    {
+        size_t count;
+        void*  ptrs[batch_size];
+
+        Batch() : count(0) {}
+    };
+
+    ~RemoteFreeList() { flush(); }
+
+    inline void insert(Core::MemPool* pool, void* ptr)
+    {
+        Batch& batch               = batches[pool];
+        batch.ptrs[batch.count++] = ptr;
+        if ( batch.count == batch_size ) {
+            pool->freeRemote(batch.ptrs, batch.count);
+            batch.count = 0;
+        }
+    }
+
+    void flush()
+    {
+        for ( auto& x : batches ) {
+            if ( x.second.count == 0 ) continue;
+            x.first->freeRemote(x.second.ptrs, x.second.count);
+            x.second.count = 0;
+        }
+    }
+
+private:
+    std::unordered_map<Core::MemPool*, Batch> batches;
+};
+
+thread_local RemoteFreeList remote_frees;
+
+} // namespace
+
+Core::MemPool*
+Activity::getMemPool(std::size_t size)
+{
+    std::thread::id tid       = std::this_thread::get_id();
+    size_t          sizeClass = getSizeClass(size);
+
+    // Sizes covered by the per-thread table are rounded up to their
+    // size class.  This is the first allocation of this class on this
+    // thread, otherwise it would have been found in the table.
+    if ( sizeClass < numSizeClasses ) {
+        size_t         classSize = sizeClass << 3;
+        Core::MemPool* pool =
+            new Core::MemPool(classSize + sizeof(PoolData_t), 2 << 20, memPoolReclaim, memPoolHugePages);
+        threadPools[sizeClass]   = pool;
+
+        std::lock_guard<std::mutex> lock(poolMutex);
+        memPools.emplace_back(tid, classSize, pool);
+        return pool;
+    }
+
+    size_t nPools = memPools.size();
+    for ( size_t i = 0; i < nPools; i++ ) {
+        PoolInfo_t& p = memPools[i];
+        if ( p.tid == tid && p.size == size ) return p.pool;
+    }
+
+    /* Still can't find it, alloc a new one */
+    Core::MemPool* pool = new Core::MemPool(size + sizeof(PoolData_t), 2 << 20, memPoolReclaim, memPoolHugePages);
+
+    std::lock_guard<std::mutex> lock(poolMutex);
+    memPools.emplace_back(tid, size, pool);
+    return pool;
+}
+
+void
+Activity::freeRemote(Core::MemPool* pool, PoolData_t* ptr)
+{
+    // Pools for sizes that don't fit in the table may still be ours
+    if ( pool->isOwner() )
+        pool->freeLocal(ptr);
+    else
+        remote_frees.insert(pool, ptr);
+}
+
+void
+Activity::flushRemoteFrees()
+{
+    remote_frees.flush();
+}
 #endif
 
 } // namespace SST
@@ -71,6 +71,9 @@ public:
 
     unsigned int getGlobalCount() { return global_count; }
 
+    /** Set the result of a check that was done without calling check() */
+    void setGlobalCount(unsigned int count) { global_count = count; }
+
 private:
     Exit() {}                    // for serialization only
     Exit(const Exit&);           // Don't implement
@@ -69,10 +69,13 @@ SimulatorHeartbeat::execute(void)
 
     uint64_t mempool_size      = 0;
     uint64_t active_activities = 0;
+    uint64_t mempool_high_water = 0, mempool_in_use = 0, mempool_reclaimed = 0;
 #ifdef USE_MEMPOOL
     Activity::getMemPoolUsage(mempool_size, active_activities);
+    Activity::getMemPoolStats(mempool_high_water, mempool_in_use, mempool_reclaimed);
 #endif
     uint64_t max_mempool_size, global_mempool_size, global_active_activities;
+    uint64_t max_mempool_high_water, global_mempool_in_use, global_mempool_reclaimed;
 
 #ifdef SST_CONFIG_HAVE_MPI
     uint64_t local_sync_data_size = Simulation_impl::getSimulation()->getSyncQueueDataSize();
@@ -83,6 +86,9 @@ SimulatorHeartbeat::execute(void)
     MPI_Allreduce(&mempool_size, &max_mempool_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&mempool_size, &global_mempool_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&active_activities, &global_active_activities, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&mempool_high_water, &max_mempool_high_water, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
+    MPI_Allreduce(&mempool_in_use, &global_mempool_in_use, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&mempool_reclaimed, &global_mempool_reclaimed, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
 #else
     global_max_tv_depth       = local_max_tv_depth;
     global_max_sync_data_size = 0;
@@ -90,6 +96,9 @@ SimulatorHeartbeat::execute(void)
     max_mempool_size          = mempool_size;
     global_mempool_size       = mempool_size;
     global_active_activities  = active_activities;
+    max_mempool_high_water    = mempool_high_water;
+    global_mempool_in_use     = mempool_in_use;
+    global_mempool_reclaimed  = mempool_reclaimed;
 #endif
 
     if ( rank == 0 ) {
@@ -110,6 +119,24 @@ SimulatorHeartbeat::execute(void)
         sim_output.output("\tMax mempool usage:               %s\n", max_mempool_size_ua.toStringBestSI().c_str());
         sim_output.output("\tGlobal mempool usage:            %s\n", global_mempool_size_ua.toStringBestSI().c_str());
         sim_output.output("\tGlobal active activities         %" PRIu64 " activities\n", global_active_activities);
+#ifdef USE_MEMPOOL
+        ua_str = format_string("%" PRIu64 "B", max_mempool_high_water);
+        UnitAlgebra max_mempool_high_water_ua(ua_str);
+
+        ua_str = format_string("%" PRIu64 "B", global_mempool_reclaimed);
+        UnitAlgebra global_mempool_reclaimed_ua(ua_str);
+
+        // Fraction of the arena space that is not holding live activities
+        double fragmentation = 0.0;
+        if ( global_mempool_in_use < global_mempool_size )
+            fragmentation = 100.0 * (1.0 - (double)global_mempool_in_use / global_mempool_size);
+
+        sim_output.output(
+            "\tMax mempool high-water:          %s\n", max_mempool_high_water_ua.toStringBestSI().c_str());
+        sim_output.output("\tGlobal mempool fragmentation:    %.1f%%\n", fragmentation);
+        sim_output.output(
+            "\tGlobal mempool reclaimed:        %s\n", global_mempool_reclaimed_ua.toStringBestSI().c_str());
+#endif
         sim_output.output("\tMax TimeVortex depth:            %" PRIu64 " entries\n", global_max_tv_depth);
         sim_output.output(
             "\tMax Sync data size:              %s\n", global_max_sync_data_size_ua.toStringBestSI().c_str());
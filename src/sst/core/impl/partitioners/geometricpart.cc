@@ -0,0 +1,174 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/geometricpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+static inline double
+componentWeight(const SST::PartitionComponent* comp)
+{
+    return comp->weight > 0 ? comp->weight : 0;
+}
+
+SSTGeometricPartition::SSTGeometricPartition(RankInfo mpiranks, RankInfo UNUSED(my_rank), int verbosity)
+{
+    rankcount  = mpiranks;
+    partOutput = new Output("GeometricPartition ", verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTGeometricPartition::~SSTGeometricPartition()
+{
+    delete partOutput;
+}
+
+void
+SSTGeometricPartition::performPartition(PartitionGraph* graph)
+{
+    PartitionComponentMap_t& compMap = graph->getComponentMap();
+
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a geometric partition scheme for simulation model.\n");
+
+    vector<PartitionComponent*> comps;
+    comps.reserve(graph->getNumComponents());
+    for ( auto compItr = compMap.begin(); compItr != compMap.end(); ++compItr ) {
+        comps.push_back(*compItr);
+    }
+
+    uint32_t total_parts = rankcount.rank * rankcount.thread;
+    bisect(comps, 0, comps.size(), 0, total_parts);
+
+    if ( partOutput->getVerboseLevel() < 1 ) return;
+
+    // Report the balance and the number of cut links
+    vector<double> part_weight(total_parts, 0);
+    for ( auto comp : comps ) {
+        part_weight[comp->rank.rank * rankcount.thread + comp->rank.thread] += componentWeight(comp);
+    }
+    auto minmax = minmax_element(part_weight.begin(), part_weight.end());
+
+    unordered_map<LinkId_t, const PartitionComponent*> link_end;
+    size_t                                             cut = 0;
+    for ( auto comp : comps ) {
+        for ( LinkId_t id : comp->links ) {
+            auto end = link_end.find(id);
+            if ( end == link_end.end() ) { link_end[id] = comp; }
+            else {
+                if ( end->second->rank != comp->rank ) cut++;
+                link_end.erase(end);
+            }
+        }
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Component Count:                  %10zu\n", comps.size());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Cut links:                        %10zu\n", cut);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Min part weight:                  %10g\n", *minmax.first);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Max part weight:                  %10g\n", *minmax.second);
+    partOutput->verbose(CALL_INFO, 1, 0, "Geometric partition scheme completed.\n");
+}
+
+void
+SSTGeometricPartition::bisect(
+    vector<PartitionComponent*>& comps, size_t first, size_t last, uint32_t first_part, uint32_t num_parts)
+{
+    if ( num_parts == 1 || last - first <= 1 ) {
+        RankInfo rank(first_part / rankcount.thread, first_part % rankcount.thread);
+        for ( size_t i = first; i < last; i++ ) {
+            comps[i]->rank = rank;
+        }
+        return;
+    }
+
+    // Split whole ranks apart before splitting the threads of a rank
+    uint32_t threads = rankcount.thread;
+    uint32_t left    = num_parts / 2;
+    if ( num_parts > threads && first_part % threads == 0 && num_parts % threads == 0 ) {
+        left = (num_parts / threads / 2) * threads;
+    }
+
+    // Cut across the dimension the components are most spread out in
+    double low[3], high[3];
+    double total = 0;
+    for ( int d = 0; d < 3; d++ ) {
+        low[d]  = comps[first]->coords[d];
+        high[d] = comps[first]->coords[d];
+    }
+    for ( size_t i = first; i < last; i++ ) {
+        for ( int d = 0; d < 3; d++ ) {
+            low[d]  = min(low[d], comps[i]->coords[d]);
+            high[d] = max(high[d], comps[i]->coords[d]);
+        }
+        total += componentWeight(comps[i]);
+    }
+    int dim = 0;
+    for ( int d = 1; d < 3; d++ ) {
+        if ( high[d] - low[d] > high[dim] - low[dim] ) dim = d;
+    }
+
+    size_t mid = split(comps, first, last, dim, total * left / num_parts);
+    bisect(comps, first, mid, first_part, left);
+    bisect(comps, mid, last, first_part + left, num_parts - left);
+}
+
+size_t
+SSTGeometricPartition::split(vector<PartitionComponent*>& comps, size_t first, size_t last, int dim, double target)
+{
+    // Weighted quickselect.  Everything before lo is already known to
+    // be before the split and weighs before.
+    double before = 0;
+    size_t lo     = first;
+    size_t hi     = last;
+    while ( hi - lo > 1 ) {
+        double pivot = comps[lo + (hi - lo) / 2]->coords[dim];
+
+        auto less_end = partition(comps.begin() + lo, comps.begin() + hi, [dim, pivot](const PartitionComponent* c) {
+            return c->coords[dim] < pivot;
+        });
+        auto equal_end = partition(
+            less_end, comps.begin() + hi, [dim, pivot](const PartitionComponent* c) { return c->coords[dim] == pivot; });
+
+        double less_weight = 0, equal_weight = 0;
+        for ( auto i = comps.begin() + lo; i != less_end; ++i )
+            less_weight += componentWeight(*i);
+        for ( auto i = less_end; i != equal_end; ++i )
+            equal_weight += componentWeight(*i);
+
+        if ( before + less_weight >= target ) { hi = less_end - comps.begin(); }
+        else if ( before + less_weight + equal_weight >= target ) {
+            // The split is among components at the same coordinate
+            before += less_weight;
+            lo = less_end - comps.begin();
+            hi = equal_end - comps.begin();
+            break;
+        }
+        else {
+            before += less_weight + equal_weight;
+            lo = equal_end - comps.begin();
+        }
+    }
+
+    // Take components while that gets closer to the target
+    while ( lo < hi && before + componentWeight(comps[lo]) / 2 < target ) {
+        before += componentWeight(comps[lo]);
+        lo++;
+    }
+    return lo;
+}
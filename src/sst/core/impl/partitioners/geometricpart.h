@@ -0,0 +1,93 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_GEOMETRICPART_H
+#define SST_CORE_IMPL_PARTITONERS_GEOMETRICPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+#include <vector>
+
+namespace SST {
+
+class Output;
+class PartitionComponent;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a recursive coordinate bisection of an SST simulation
+configuration, using the coordinates set on the components with
+setCoordinates() in the Python model.  The components are split in two
+across the dimension in which they are most spread out, at the point
+that divides their weight between the two halves in proportion to the
+number of parts (one per rank and thread) on each side.  The ranks are
+split before the threads within a rank.
+
+This takes no account of the links, but for models laid out in space,
+such as meshes and tori, it gives cuts close to the best possible in
+time that grows only with the number of components times the number
+of levels of bisection.  Groups of components joined by no-cut links
+are placed at the average of their coordinates.  Components without
+coordinates are at the origin, so if none have coordinates this is the
+same as splitting them in order of their ids.
+*/
+class SSTGeometricPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTGeometricPartition,
+        "sst",
+        "geometric",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Recursive coordinate bisection of the component coordinates set with setCoordinates(), balancing component "
+        "weights.")
+
+    /**
+       Creates a new geometric partition scheme.
+       \param rankCount Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTGeometricPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+    ~SSTGeometricPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+
+private:
+    /** Assign comps[first, last) to num_parts parts starting at first_part */
+    void bisect(
+        std::vector<PartitionComponent*>& comps, size_t first, size_t last, uint32_t first_part, uint32_t num_parts);
+
+    /** Reorder comps[first, last) by coordinate dim around the point
+     * that puts target weight before it, and return that point */
+    size_t split(std::vector<PartitionComponent*>& comps, size_t first, size_t last, int dim, double target);
+
+    /** Number of ranks and threads in the simulation */
+    RankInfo rankcount;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_GEOMETRICPART_H
@@ -0,0 +1,194 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/hierarchicalpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+#ifdef __linux__
+// Parse a Linux list such as "0-3,8"
+static bool
+parseList(const string& list, vector<uint32_t>& items)
+{
+    stringstream ranges(list);
+    string       range;
+    while ( getline(ranges, range, ',') ) {
+        size_t dash = range.find('-');
+        try {
+            if ( dash == string::npos ) { items.push_back(stoul(range)); }
+            else {
+                uint32_t last = stoul(range.substr(dash + 1));
+                for ( uint32_t i = stoul(range.substr(0, dash)); i <= last; i++ )
+                    items.push_back(i);
+            }
+        }
+        catch ( exception& ) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool
+readList(const string& file, vector<uint32_t>& items)
+{
+    ifstream in(file);
+    string   list;
+    if ( !in.is_open() || !getline(in, list) ) return false;
+    return parseList(list, items);
+}
+#endif
+
+SSTHierarchicalPartition::SSTHierarchicalPartition(RankInfo mpiranks, RankInfo my_rank, int verbosity) :
+    SSTMultilevelPartition(mpiranks, my_rank, verbosity, "HierarchicalPartition ")
+{
+    domains = countDomains(rankcount.thread);
+}
+
+void
+SSTHierarchicalPartition::performPartition(PartitionGraph* pgraph)
+{
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a hierarchical partition scheme for simulation model.\n");
+    partOutput->verbose(CALL_INFO, 1, 0, "- NUMA domains per rank:            %10" PRIu32 "\n", domains);
+
+    // The hierarchy is all in splitParts
+    SSTMultilevelPartition::performPartition(pgraph);
+
+    // Find how much of the cut is at each level of the hierarchy
+    vector<PartitionComponent*> comps;
+    vector<Edge>                edges;
+    getEdges(pgraph, comps, edges);
+
+    double rank_cut = 0, domain_cut = 0, thread_cut = 0;
+    for ( auto& e : edges ) {
+        const RankInfo& a = comps[e.end[0]]->rank;
+        const RankInfo& b = comps[e.end[1]]->rank;
+        if ( a == b ) continue;
+        double weight = getLinkWeight(*e.link);
+        if ( a.rank != b.rank )
+            rank_cut += weight;
+        else if ( domainOf(a.thread) != domainOf(b.thread) )
+            domain_cut += weight;
+        else
+            thread_cut += weight;
+    }
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Cut weight between ranks:         %10g\n", rank_cut);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Cut weight between NUMA domains:  %10g\n", domain_cut);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Cut weight within NUMA domains:   %10g\n", thread_cut);
+    partOutput->verbose(CALL_INFO, 1, 0, "Hierarchical partition scheme completed.\n");
+}
+
+bool
+SSTHierarchicalPartition::getDomainCpus(vector<vector<uint32_t>>& domain_cpus)
+{
+    domain_cpus.clear();
+#ifdef __linux__
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    if ( sched_getaffinity(0, sizeof(allowed), &allowed) != 0 ) return false;
+
+    // Memory-only nodes can't run threads, so only look at the nodes
+    // with CPUs, and of those only at the CPUs this process may use
+    vector<uint32_t> nodes;
+    if ( !readList("/sys/devices/system/node/has_cpu", nodes) ) return false;
+    for ( uint32_t node : nodes ) {
+        vector<uint32_t> node_cpus;
+        if ( !readList("/sys/devices/system/node/node" + to_string(node) + "/cpulist", node_cpus) ) return false;
+
+        vector<uint32_t> usable;
+        for ( uint32_t cpu : node_cpus ) {
+            if ( cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed) ) usable.push_back(cpu);
+        }
+        if ( !usable.empty() ) domain_cpus.push_back(usable);
+    }
+    return !domain_cpus.empty();
+#else
+    return false;
+#endif
+}
+
+uint32_t
+SSTHierarchicalPartition::countDomains(uint32_t threads)
+{
+    vector<vector<uint32_t>> domain_cpus;
+    uint32_t                 count = getDomainCpus(domain_cpus) ? domain_cpus.size() : 1;
+    return count > threads ? threads : count;
+}
+
+bool
+SSTHierarchicalPartition::getThreadCpus(uint32_t threads, vector<vector<uint32_t>>& cpus)
+{
+    vector<vector<uint32_t>> domain_cpus;
+    if ( !getDomainCpus(domain_cpus) ) return false;
+
+    uint32_t num_domains = countDomains(threads);
+    cpus.resize(threads);
+    for ( uint32_t t = 0; t < threads; t++ ) {
+        cpus[t] = domain_cpus[domainOf(t, threads, num_domains)];
+    }
+    return true;
+}
+
+bool
+SSTHierarchicalPartition::bindThread(const vector<uint32_t>& cpus)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for ( uint32_t cpu : cpus ) {
+        CPU_SET(cpu, &set);
+    }
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    (void)cpus;
+    return false;
+#endif
+}
+
+uint32_t
+SSTHierarchicalPartition::splitParts(uint32_t first_part, uint32_t num_parts)
+{
+    // Split whole ranks apart first
+    uint32_t threads = rankcount.thread;
+    if ( num_parts > threads && first_part % threads == 0 && num_parts % threads == 0 ) {
+        return SSTMultilevelPartition::splitParts(first_part, num_parts);
+    }
+
+    // Then the NUMA domains of a rank, splitting at the domain boundary
+    // closest to the middle, and finally the threads of a domain
+    uint32_t first_thread = first_part % threads;
+    uint32_t first_domain = domainOf(first_thread);
+    uint32_t last_domain  = domainOf(first_thread + num_parts - 1);
+    if ( first_domain == last_domain ) return num_parts / 2;
+
+    uint32_t best = 0;
+    for ( uint32_t d = first_domain + 1; d <= last_domain; d++ ) {
+        uint32_t left = domainStart(d) - first_thread;
+        if ( best == 0 || abs((int)(2 * left) - (int)num_parts) < abs((int)(2 * best) - (int)num_parts) ) best = left;
+    }
+    return best;
+}
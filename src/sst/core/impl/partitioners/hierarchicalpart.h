@@ -0,0 +1,128 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_HIERARCHICALPART_H
+#define SST_CORE_IMPL_PARTITONERS_HIERARCHICALPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include <vector>
+
+namespace SST {
+namespace IMPL {
+namespace Partition {
+
+/**
+Partitions an SST simulation configuration following the hardware
+hierarchy: first across ranks, then across the NUMA domains of a rank,
+then across the threads within a domain.  Each level is split with the
+multilevel scheme, so the links between components in different
+domains are cut as little as possible and heavily communicating
+components end up on threads that share a socket.
+
+The number of NUMA domains is the number of nodes listed in
+/sys/devices/system/node on Linux that have CPUs this process may run
+on, and is 1 (a flat thread partition) where that isn't available.
+The threads of each rank are taken to be laid out in equal blocks, in
+order, across the domains.  SST doesn't place threads by default; run
+with --thread-numa-binding to bind them this way.
+
+The partition is computed on rank 0, so every rank is assumed to have
+the same number of domains as rank 0.  --thread-numa-binding warns on
+any rank where that isn't the case.
+*/
+class SSTHierarchicalPartition : public SSTMultilevelPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTHierarchicalPartition,
+        "sst",
+        "hierarchical",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioner that splits ranks, then the NUMA domains of a rank, then the threads within a domain, "
+        "to keep heavily communicating components on the same socket.")
+
+    /**
+       Creates a new hierarchical partition scheme.
+       \param rankCount Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTHierarchicalPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    /**
+       NUMA domain of a thread when the threads of a rank are laid out
+       in equal blocks, in order, across the domains
+    */
+    static uint32_t domainOf(uint32_t thread, uint32_t threads, uint32_t domains)
+    {
+        return (uint64_t)thread * domains / threads;
+    }
+
+    /**
+       Finds the NUMA domains this process may run on, which are the
+       domains the partitioner splits threads across
+       \param domain_cpus Set to the CPUs this process may use in each domain
+       \return false if the NUMA layout isn't available
+    */
+    static bool getDomainCpus(std::vector<std::vector<uint32_t>>& domain_cpus);
+
+    /**
+       Number of NUMA domains the threads of a rank are spread over
+       \param threads Number of threads in the rank
+    */
+    static uint32_t countDomains(uint32_t threads);
+
+    /**
+       Finds the CPUs each thread of this process should be bound to so
+       that the threads are laid out across the NUMA domains as the
+       partitioner assumes.
+       \param threads Number of threads in the rank
+       \param cpus Set to the CPUs of each thread
+       \return false if the NUMA layout isn't available
+    */
+    static bool getThreadCpus(uint32_t threads, std::vector<std::vector<uint32_t>>& cpus);
+
+    /**
+       Binds the calling thread to the given CPUs
+       \return false if the thread couldn't be bound
+    */
+    static bool bindThread(const std::vector<uint32_t>& cpus);
+
+protected:
+    uint32_t splitParts(uint32_t first_part, uint32_t num_parts) override;
+
+private:
+    /** NUMA domain of a thread within its rank */
+    uint32_t domainOf(uint32_t thread) const { return domainOf(thread, rankcount.thread, domains); }
+
+    /** First thread of a NUMA domain */
+    uint32_t domainStart(uint32_t domain) const
+    {
+        return ((uint64_t)domain * rankcount.thread + domains - 1) / domains;
+    }
+
+    /** Number of NUMA domains the threads of a rank are spread over */
+    uint32_t domains;
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_HIERARCHICALPART_H
@@ -0,0 +1,265 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/lookaheadpart.h"
+
+#include "sst/core/config.h"
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/timeLord.h"
+#include "sst/core/unitAlgebra.h"
+
+#include <algorithm>
+
+using namespace std;
+using namespace SST;
+using namespace SST::IMPL::Partition;
+
+// How much heavier than the mean weight the heaviest part may be, unless
+// the no-cut groups alone already make it heavier
+#define LOOKAHEAD_IMBALANCE 0.05
+
+static string
+formatLatency(SimTime_t cycles)
+{
+    if ( cycles == MAX_SIMTIME_T ) return "none cut";
+    return (Simulation_impl::getTimeLord()->getTimeBase() * cycles).toStringBestSI();
+}
+
+SSTLookaheadPartition::SSTLookaheadPartition(RankInfo mpiranks, RankInfo my_rank, int verbosity) :
+    SSTMultilevelPartition(mpiranks, my_rank, verbosity, "LookaheadPartition ")
+{}
+
+void
+SSTLookaheadPartition::configure(const Config& cfg)
+{
+    lookahead = cfg.partition_lookahead();
+}
+
+void
+SSTLookaheadPartition::performPartition(PartitionGraph* pgraph)
+{
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a lookahead partition scheme for simulation model.\n");
+
+    vector<PartitionComponent*> comps;
+    vector<Edge>                edges;
+    getEdges(pgraph, comps, edges);
+
+    uint32_t       n = comps.size();
+    vector<double> vwgt(n);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        vwgt[i] = comps[i]->weight > 0 ? comps[i]->weight : 0;
+    }
+
+    // The no-cut groups alone can keep the parts from being exactly
+    // balanced, so the tolerance is measured from a partition that
+    // groups nothing else
+    Graph            graph;
+    vector<uint32_t> group_parts;
+    vector<uint32_t> parts;
+    double           imbalance = partitionGroups(vwgt, edges, 0, graph, group_parts, parts);
+    double           tolerance = max(1.0 + LOOKAHEAD_IMBALANCE, imbalance);
+
+    SimTime_t threshold;
+    if ( lookahead.empty() ) { threshold = findThreshold(vwgt, edges, tolerance, graph, group_parts, parts, imbalance); }
+    else {
+        threshold = Simulation_impl::getTimeLord()->getSimCycles(lookahead, "--partition-lookahead");
+        imbalance = partitionGroups(vwgt, edges, threshold, graph, group_parts, parts);
+    }
+
+    if ( imbalance > tolerance ) {
+        partOutput->output(
+            "WARNING: Links below the lookahead threshold of %s keep the partition from being balanced: the heaviest "
+            "part has %g times the mean weight, over the %g allowed.\n",
+            formatLatency(threshold).c_str(), imbalance, tolerance);
+    }
+
+    for ( uint32_t i = 0; i < n; i++ ) {
+        comps[i]->rank = RankInfo(parts[i] / rankcount.thread, parts[i] % rankcount.thread);
+    }
+
+    // Find the lookahead that was achieved between ranks and between
+    // any two threads
+    SimTime_t rank_lookahead   = MAX_SIMTIME_T;
+    SimTime_t thread_lookahead = MAX_SIMTIME_T;
+    for ( auto& e : edges ) {
+        uint32_t  part[2] = { parts[e.end[0]], parts[e.end[1]] };
+        SimTime_t latency = e.link->getMinLatency();
+        if ( part[0] == part[1] ) continue;
+        if ( latency < thread_lookahead ) thread_lookahead = latency;
+        if ( part[0] / rankcount.thread != part[1] / rankcount.thread && latency < rank_lookahead )
+            rank_lookahead = latency;
+    }
+
+    partOutput->verbose(
+        CALL_INFO, 1, 0, "- Lookahead threshold:              %10s\n", formatLatency(threshold).c_str());
+    partOutput->verbose(CALL_INFO, 1, 0, "- Components:                       %10" PRIu32 "\n", n);
+    report(graph, group_parts);
+    partOutput->verbose(
+        CALL_INFO, 1, 0, "- Lookahead between ranks:          %10s\n", formatLatency(rank_lookahead).c_str());
+    partOutput->verbose(
+        CALL_INFO, 1, 0, "- Lookahead between threads:        %10s\n", formatLatency(thread_lookahead).c_str());
+    partOutput->verbose(CALL_INFO, 1, 0, "Lookahead partition scheme completed.\n");
+}
+
+double
+SSTLookaheadPartition::partitionGroups(
+    const vector<double>& vwgt, const vector<Edge>& edges, SimTime_t threshold, Graph& graph,
+    vector<uint32_t>& group_parts, vector<uint32_t>& parts)
+{
+    // Collapse the groups into single vertices
+    uint32_t         n = vwgt.size();
+    vector<uint32_t> group;
+    uint32_t         ngroups = groupVertices(n, edges, threshold, group);
+
+    vector<double> group_vwgt(ngroups, 0);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        group_vwgt[group[i]] += vwgt[i];
+    }
+
+    vector<Edge> group_edges;
+    for ( auto& e : edges ) {
+        if ( group[e.end[0]] == group[e.end[1]] ) continue;
+        Edge edge   = e;
+        edge.end[0] = group[e.end[0]];
+        edge.end[1] = group[e.end[1]];
+        edge.weight = getLinkWeight(*e.link);
+        group_edges.push_back(edge);
+    }
+
+    buildGraph(group_vwgt, group_edges, graph);
+    partitionGraph(graph, group_parts);
+
+    parts.resize(n);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        parts[i] = group_parts[group[i]];
+    }
+
+    uint32_t       num_parts = rankcount.rank * rankcount.thread;
+    double         total     = 0;
+    vector<double> part_weight(num_parts, 0);
+    for ( uint32_t g = 0; g < ngroups; g++ ) {
+        part_weight[group_parts[g]] += group_vwgt[g];
+        total += group_vwgt[g];
+    }
+    if ( total == 0 ) return 1.0;
+    return *max_element(part_weight.begin(), part_weight.end()) * num_parts / total;
+}
+
+uint32_t
+SSTLookaheadPartition::groupVertices(
+    uint32_t n, const vector<Edge>& edges, SimTime_t threshold, vector<uint32_t>& group)
+{
+    // Union-find, with each set pointing at its lowest vertex
+    vector<uint32_t> parent(n);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        parent[i] = i;
+    }
+    auto find = [&parent](uint32_t v) {
+        while ( parent[v] != v ) {
+            parent[v] = parent[parent[v]];
+            v         = parent[v];
+        }
+        return v;
+    };
+    for ( auto& e : edges ) {
+        if ( e.link->getMinLatency() >= threshold ) continue;
+        uint32_t a = find(e.end[0]);
+        uint32_t b = find(e.end[1]);
+        if ( a < b )
+            parent[b] = a;
+        else if ( b < a )
+            parent[a] = b;
+    }
+
+    // Number the groups in order of their lowest vertex
+    uint32_t ngroups = 0;
+    group.resize(n);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        uint32_t root = find(i);
+        group[i]      = root == i ? ngroups++ : group[root];
+    }
+    return ngroups;
+}
+
+SimTime_t
+SSTLookaheadPartition::findThreshold(
+    const vector<double>& vwgt, const vector<Edge>& edges, double tolerance, Graph& graph,
+    vector<uint32_t>& group_parts, vector<uint32_t>& parts, double& imbalance)
+{
+    // The lookahead can only be one of the link latencies, or
+    // unlimited if no link has to be cut
+    vector<SimTime_t> latencies;
+    for ( auto& e : edges ) {
+        latencies.push_back(e.link->getMinLatency());
+    }
+    latencies.push_back(MAX_SIMTIME_T);
+    sort(latencies.begin(), latencies.end());
+    latencies.erase(unique(latencies.begin(), latencies.end()), latencies.end());
+
+    // No threshold can be balanced once a single group is heavier than
+    // a part's share.  The groups only get heavier as the threshold
+    // goes up, so that bounds the search cheaply.
+    uint32_t n     = vwgt.size();
+    double   total = 0;
+    for ( double w : vwgt ) {
+        total += w;
+    }
+    double           share = tolerance * total / (rankcount.rank * rankcount.thread);
+    vector<uint32_t> group;
+    size_t           low  = 0;
+    size_t           high = latencies.size() - 1;
+    while ( low < high ) {
+        size_t         mid     = (low + high + 1) / 2;
+        uint32_t       ngroups = groupVertices(n, edges, latencies[mid], group);
+        vector<double> weight(ngroups, 0);
+        bool           fits = true;
+        for ( uint32_t i = 0; i < n && fits; i++ ) {
+            weight[group[i]] += vwgt[i];
+            fits = weight[group[i]] <= share;
+        }
+        if ( fits )
+            low = mid;
+        else
+            high = mid - 1;
+    }
+
+    // Whether the groups can actually be balanced depends on how they
+    // pack into the parts, so search again, partitioning at each
+    // candidate and keeping the partition of the largest threshold
+    // found that stays within the tolerance.  The balance isn't
+    // strictly monotonic in the threshold, so this finds a large
+    // threshold rather than always the largest.  The smallest latency
+    // groups nothing, so the partition passed in is kept for it.
+    high = low;
+    low  = 0;
+    while ( low < high ) {
+        size_t           mid = (low + high + 1) / 2;
+        Graph            trial_graph;
+        vector<uint32_t> trial_group_parts;
+        vector<uint32_t> trial_parts;
+        double trial = partitionGroups(vwgt, edges, latencies[mid], trial_graph, trial_group_parts, trial_parts);
+        if ( trial <= tolerance ) {
+            low       = mid;
+            imbalance = trial;
+            graph     = std::move(trial_graph);
+            group_parts.swap(trial_group_parts);
+            parts.swap(trial_parts);
+        }
+        else {
+            high = mid - 1;
+        }
+    }
+    return latencies[low];
+}
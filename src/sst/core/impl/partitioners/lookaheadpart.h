@@ -0,0 +1,91 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_LOOKAHEADPART_H
+#define SST_CORE_IMPL_PARTITONERS_LOOKAHEADPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace IMPL {
+namespace Partition {
+
+/**
+Partitions an SST simulation configuration to make the minimum latency
+of the cut links (the lookahead used to schedule the rank and thread
+syncs) as large as possible.
+
+Links with a latency below a threshold are treated as no-cut links: the
+components they join are grouped before partitioning.  The threshold is
+set with --partition-lookahead, or by default is the largest link
+latency for which the partition of the groups is still balanced.  The
+groups are then partitioned with the multilevel scheme, and the
+achieved lookahead is reported.
+*/
+class SSTLookaheadPartition : public SSTMultilevelPartition
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTLookaheadPartition,
+        "sst",
+        "lookahead",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel partitioner that never cuts links below a latency threshold, found automatically or set with "
+        "--partition-lookahead, to maximize the lookahead between ranks and threads.")
+
+    /**
+       Creates a new lookahead partition scheme.
+       \param rankCount Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTLookaheadPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+
+    void configure(const Config& cfg) override;
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+private:
+    /** Group the vertices joined by edges with a latency below
+     * threshold, returning the number of groups */
+    uint32_t groupVertices(
+        uint32_t n, const std::vector<Edge>& edges, SimTime_t threshold, std::vector<uint32_t>& group);
+
+    /** Partition with the links below threshold left uncut.  Sets the
+     * graph of the groups, the part of each group and the part of each
+     * vertex, and returns the heaviest part weight over the mean. */
+    double partitionGroups(
+        const std::vector<double>& vwgt, const std::vector<Edge>& edges, SimTime_t threshold, Graph& graph,
+        std::vector<uint32_t>& group_parts, std::vector<uint32_t>& parts);
+
+    /** Find a large threshold whose partition is within tolerance,
+     * replacing the partition passed in (which groups nothing) with
+     * the one for that threshold */
+    SimTime_t findThreshold(
+        const std::vector<double>& vwgt, const std::vector<Edge>& edges, double tolerance, Graph& graph,
+        std::vector<uint32_t>& group_parts, std::vector<uint32_t>& parts, double& imbalance);
+
+    std::string lookahead;
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_LOOKAHEADPART_H
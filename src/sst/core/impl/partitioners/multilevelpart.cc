@@ -0,0 +1,621 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/partitioners/multilevelpart.h"
+
+#include "sst/core/configGraph.h"
+#include "sst/core/output.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <queue>
+#include <unordered_map>
+
+using namespace std;
+using namespace SST::IMPL::Partition;
+
+// Stop coarsening once a graph has this many vertices
+#define MULTILEVEL_COARSEST_SIZE  64
+// Allowed deviation from the target weight of a side in one bisection,
+// as a fraction of the smaller side.  The deviations add up over the
+// levels of the recursion.
+#define MULTILEVEL_IMBALANCE      0.01
+// Number of Fiduccia-Mattheyses passes per level
+#define MULTILEVEL_REFINE_PASSES  8
+// Number of seeds tried for the initial bisection
+#define MULTILEVEL_INITIAL_TRIES  8
+
+static const uint32_t UNMATCHED = UINT32_MAX;
+
+SSTMultilevelPartition::SSTMultilevelPartition(RankInfo mpiranks, RankInfo my_rank, int verbosity) :
+    SSTMultilevelPartition(mpiranks, my_rank, verbosity, "MultilevelPartition ")
+{}
+
+SSTMultilevelPartition::SSTMultilevelPartition(
+    RankInfo mpiranks, RankInfo UNUSED(my_rank), int verbosity, const std::string& prefix) :
+    rankcount(mpiranks),
+    random_state(0x853c49e6748fea9bULL)
+{
+    partOutput = new Output(prefix, verbosity, 0, SST::Output::STDOUT);
+}
+
+SSTMultilevelPartition::~SSTMultilevelPartition()
+{
+    delete partOutput;
+}
+
+double
+SSTMultilevelPartition::getLinkWeight(const PartitionLink& link)
+{
+    return link.weight;
+}
+
+void
+SSTMultilevelPartition::performPartition(PartitionGraph* pgraph)
+{
+    partOutput->verbose(CALL_INFO, 1, 0, "Performing a multilevel partition scheme for simulation model.\n");
+
+    vector<PartitionComponent*> comps;
+    vector<Edge>                edges;
+    getEdges(pgraph, comps, edges);
+
+    uint32_t       n = comps.size();
+    vector<double> vwgt(n);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        vwgt[i] = comps[i]->weight > 0 ? comps[i]->weight : 0;
+    }
+    for ( auto& e : edges ) {
+        e.weight = getLinkWeight(*e.link);
+    }
+
+    Graph graph;
+    buildGraph(vwgt, edges, graph);
+
+    vector<uint32_t> parts;
+    partitionGraph(graph, parts);
+
+    for ( uint32_t i = 0; i < n; i++ ) {
+        comps[i]->rank = RankInfo(parts[i] / rankcount.thread, parts[i] % rankcount.thread);
+    }
+
+    report(graph, parts);
+    partOutput->verbose(CALL_INFO, 1, 0, "Multilevel partition scheme completed.\n");
+}
+
+void
+SSTMultilevelPartition::getEdges(PartitionGraph* pgraph, vector<PartitionComponent*>& comps, vector<Edge>& edges)
+{
+    PartitionComponentMap_t& compMap = pgraph->getComponentMap();
+    PartitionLinkMap_t&      linkMap = pgraph->getLinkMap();
+
+    // Each collapsed component lists the links that leave it, so a
+    // link's two ends are the two components that list it
+    unordered_map<LinkId_t, uint32_t> link_end;
+    for ( auto compItr = compMap.begin(); compItr != compMap.end(); ++compItr ) {
+        uint32_t index = comps.size();
+        comps.push_back(*compItr);
+        for ( LinkId_t id : (*compItr)->links ) {
+            auto end = link_end.find(id);
+            if ( end == link_end.end() ) { link_end[id] = index; }
+            else {
+                if ( end->second != index ) {
+                    Edge edge;
+                    edge.end[0] = end->second;
+                    edge.end[1] = index;
+                    edge.link   = &linkMap[id];
+                    edge.weight = 1.0;
+                    edges.push_back(edge);
+                }
+                link_end.erase(end);
+            }
+        }
+    }
+}
+
+void
+SSTMultilevelPartition::buildGraph(const vector<double>& vwgt, const vector<Edge>& edges, Graph& graph)
+{
+    uint32_t n = vwgt.size();
+    graph.vwgt = vwgt;
+
+    vector<uint32_t> start(n + 1, 0);
+    for ( auto& e : edges ) {
+        start[e.end[0] + 1]++;
+        start[e.end[1] + 1]++;
+    }
+    for ( uint32_t i = 0; i < n; i++ ) {
+        start[i + 1] += start[i];
+    }
+    vector<uint32_t> raw_adj(start[n]);
+    vector<double>   raw_wgt(start[n]);
+    vector<uint32_t> fill(start.begin(), start.end() - 1);
+    for ( auto& e : edges ) {
+        uint32_t u         = e.end[0];
+        uint32_t v         = e.end[1];
+        raw_adj[fill[u]]   = v;
+        raw_wgt[fill[u]++] = e.weight;
+        raw_adj[fill[v]]   = u;
+        raw_wgt[fill[v]++] = e.weight;
+    }
+
+    // Merge parallel links into one edge
+    vector<int64_t> where(n, -1);
+    graph.xadj.assign(1, 0);
+    graph.adj.clear();
+    graph.ewgt.clear();
+    for ( uint32_t u = 0; u < n; u++ ) {
+        size_t first = graph.adj.size();
+        for ( uint32_t j = start[u]; j < start[u + 1]; j++ ) {
+            uint32_t v = raw_adj[j];
+            if ( where[v] >= 0 ) { graph.ewgt[where[v]] += raw_wgt[j]; }
+            else {
+                where[v] = graph.adj.size();
+                graph.adj.push_back(v);
+                graph.ewgt.push_back(raw_wgt[j]);
+            }
+        }
+        for ( size_t j = first; j < graph.adj.size(); j++ ) {
+            where[graph.adj[j]] = -1;
+        }
+        graph.xadj.push_back(graph.adj.size());
+    }
+}
+
+void
+SSTMultilevelPartition::partitionGraph(const Graph& graph, vector<uint32_t>& parts)
+{
+    uint32_t         n = graph.size();
+    vector<uint32_t> ids(n);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        ids[i] = i;
+    }
+    parts.assign(n, 0);
+    partition(graph, ids, 0, rankcount.rank * rankcount.thread, parts);
+}
+
+void
+SSTMultilevelPartition::report(const Graph& graph, const vector<uint32_t>& parts)
+{
+    uint32_t n    = graph.size();
+    double   cut  = 0;
+    size_t   ncut = 0;
+    for ( uint32_t u = 0; u < n; u++ ) {
+        for ( uint32_t j = graph.xadj[u]; j < graph.xadj[u + 1]; j++ ) {
+            if ( u < graph.adj[j] && parts[u] != parts[graph.adj[j]] ) {
+                cut += graph.ewgt[j];
+                ncut++;
+            }
+        }
+    }
+    vector<double> part_weight(rankcount.rank * rankcount.thread, 0);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        part_weight[parts[i]] += graph.vwgt[i];
+    }
+    auto minmax = minmax_element(part_weight.begin(), part_weight.end());
+
+    partOutput->verbose(CALL_INFO, 1, 0, "- Vertices:                         %10" PRIu32 "\n", n);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Cut edges:                        %10zu\n", ncut);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Cut weight:                       %10g\n", cut);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Min part weight:                  %10g\n", *minmax.first);
+    partOutput->verbose(CALL_INFO, 1, 0, "- Max part weight:                  %10g\n", *minmax.second);
+}
+
+uint32_t
+SSTMultilevelPartition::splitParts(uint32_t first_part, uint32_t num_parts)
+{
+    // Split whole ranks apart before splitting the threads of a rank
+    uint32_t threads = rankcount.thread;
+    if ( num_parts > threads && first_part % threads == 0 && num_parts % threads == 0 ) {
+        return (num_parts / threads / 2) * threads;
+    }
+    return num_parts / 2;
+}
+
+void
+SSTMultilevelPartition::partition(
+    const Graph& graph, const vector<uint32_t>& ids, uint32_t first_part, uint32_t num_parts, vector<uint32_t>& parts)
+{
+    if ( num_parts == 1 || graph.size() == 0 ) {
+        for ( uint32_t id : ids ) {
+            parts[id] = first_part;
+        }
+        return;
+    }
+
+    uint32_t        left = splitParts(first_part, num_parts);
+    vector<uint8_t> side;
+    bisect(graph, (double)left / num_parts, side);
+
+    for ( uint8_t which = 0; which < 2; which++ ) {
+        Graph            sub;
+        vector<uint32_t> vmap;
+        subgraph(graph, side, which, sub, vmap);
+
+        vector<uint32_t> sub_ids(vmap.size());
+        for ( size_t i = 0; i < vmap.size(); i++ ) {
+            sub_ids[i] = ids[vmap[i]];
+        }
+
+        if ( which == 0 ) { partition(sub, sub_ids, first_part, left, parts); }
+        else {
+            partition(sub, sub_ids, first_part + left, num_parts - left, parts);
+        }
+    }
+}
+
+void
+SSTMultilevelPartition::bisect(const Graph& graph, double fraction, vector<uint8_t>& side)
+{
+    // Coarsen until the graph is small or stops shrinking.  A deque
+    // keeps the levels in place as more are added.
+    deque<Graph>            levels;
+    deque<vector<uint32_t>> cmaps;
+    const Graph*            current = &graph;
+    while ( current->size() > MULTILEVEL_COARSEST_SIZE ) {
+        levels.emplace_back();
+        cmaps.emplace_back();
+        coarsen(*current, levels.back(), cmaps.back());
+        if ( levels.back().size() > current->size() * 0.9 ) {
+            levels.pop_back();
+            cmaps.pop_back();
+            break;
+        }
+        current = &levels.back();
+    }
+
+    initialBisection(*current, fraction, side);
+
+    // Project back up through the levels, refining at each one
+    for ( size_t level = levels.size(); level > 0; level-- ) {
+        const Graph&            fine = level == 1 ? graph : levels[level - 2];
+        const vector<uint32_t>& cmap = cmaps[level - 1];
+
+        vector<uint8_t> fine_side(fine.size());
+        for ( uint32_t v = 0; v < fine.size(); v++ ) {
+            fine_side[v] = side[cmap[v]];
+        }
+        side.swap(fine_side);
+        refine(fine, fraction, side);
+    }
+}
+
+void
+SSTMultilevelPartition::coarsen(const Graph& fine, Graph& coarse, vector<uint32_t>& cmap)
+{
+    uint32_t n     = fine.size();
+    double   total = 0;
+    for ( double w : fine.vwgt ) {
+        total += w;
+    }
+    // Keep coarse vertices small enough that the coarsest graph can
+    // still be balanced
+    double max_vwgt = 1.5 * total / MULTILEVEL_COARSEST_SIZE;
+
+    // Heavy edge matching, visiting the vertices in random order
+    vector<uint32_t> order;
+    randomOrder(n, order);
+    vector<uint32_t> match(n, UNMATCHED);
+    for ( uint32_t v : order ) {
+        if ( match[v] != UNMATCHED ) continue;
+        uint32_t best   = v;
+        double   best_w = -1;
+        for ( uint32_t j = fine.xadj[v]; j < fine.xadj[v + 1]; j++ ) {
+            uint32_t u = fine.adj[j];
+            if ( match[u] == UNMATCHED && fine.ewgt[j] > best_w && fine.vwgt[v] + fine.vwgt[u] <= max_vwgt ) {
+                best   = u;
+                best_w = fine.ewgt[j];
+            }
+        }
+        match[v]    = best;
+        match[best] = v;
+    }
+
+    cmap.assign(n, UNMATCHED);
+    uint32_t nc = 0;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( cmap[v] != UNMATCHED ) continue;
+        cmap[v]        = nc;
+        cmap[match[v]] = nc;
+        nc++;
+    }
+
+    coarse.vwgt.assign(nc, 0);
+    coarse.xadj.clear();
+    coarse.adj.clear();
+    coarse.ewgt.clear();
+    coarse.xadj.reserve(nc + 1);
+    coarse.xadj.push_back(0);
+
+    // Merge the edges of each matched pair, dropping the edge
+    // between them
+    vector<int64_t> where(nc, -1);
+    uint32_t        c = 0;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( cmap[v] != c ) continue;
+        size_t   first   = coarse.adj.size();
+        uint32_t pair[2] = { v, match[v] };
+        for ( int k = 0; k < (pair[0] == pair[1] ? 1 : 2); k++ ) {
+            uint32_t f = pair[k];
+            coarse.vwgt[c] += fine.vwgt[f];
+            for ( uint32_t j = fine.xadj[f]; j < fine.xadj[f + 1]; j++ ) {
+                uint32_t u = cmap[fine.adj[j]];
+                if ( u == c ) continue;
+                if ( where[u] >= 0 ) { coarse.ewgt[where[u]] += fine.ewgt[j]; }
+                else {
+                    where[u] = coarse.adj.size();
+                    coarse.adj.push_back(u);
+                    coarse.ewgt.push_back(fine.ewgt[j]);
+                }
+            }
+        }
+        for ( size_t j = first; j < coarse.adj.size(); j++ ) {
+            where[coarse.adj[j]] = -1;
+        }
+        coarse.xadj.push_back(coarse.adj.size());
+        c++;
+    }
+}
+
+void
+SSTMultilevelPartition::initialBisection(const Graph& graph, double fraction, vector<uint8_t>& side)
+{
+    uint32_t n     = graph.size();
+    double   total = 0;
+    for ( double w : graph.vwgt ) {
+        total += w;
+    }
+    double target = fraction * total;
+
+    double   best_cut = -1;
+    uint32_t tries    = n < MULTILEVEL_INITIAL_TRIES ? n : MULTILEVEL_INITIAL_TRIES;
+    for ( uint32_t t = 0; t < tries; t++ ) {
+        // Grow side 0 from a seed, always adding the vertex most
+        // connected to what has been added so far
+        vector<uint8_t> trial(n, 1);
+        vector<double>  gain(n, 0);
+        for ( uint32_t v = 0; v < n; v++ ) {
+            for ( uint32_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+                gain[v] -= graph.ewgt[j];
+            }
+        }
+
+        priority_queue<pair<double, uint32_t>> queue;
+        uint32_t                               next_seed = (uint64_t)t * n / tries;
+        double                                 weight    = 0;
+        uint32_t                               scanned   = 0;
+        queue.emplace(gain[next_seed], next_seed);
+        while ( weight < target ) {
+            if ( queue.empty() ) {
+                // Disconnected; start again from a vertex not yet added
+                while ( scanned < n && trial[scanned] == 0 )
+                    scanned++;
+                if ( scanned == n ) break;
+                queue.emplace(gain[scanned], scanned);
+            }
+            auto top = queue.top();
+            queue.pop();
+            uint32_t v = top.second;
+            if ( trial[v] == 0 || top.first != gain[v] ) continue;
+            // Stop if adding this vertex takes us further from the target
+            if ( weight > 0 && weight + graph.vwgt[v] - target > target - weight ) break;
+
+            trial[v] = 0;
+            weight += graph.vwgt[v];
+            for ( uint32_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+                uint32_t u = graph.adj[j];
+                if ( trial[u] == 0 ) continue;
+                gain[u] += 2 * graph.ewgt[j];
+                queue.emplace(gain[u], u);
+            }
+        }
+
+        refine(graph, fraction, trial);
+        double cut = cutWeight(graph, trial);
+        if ( best_cut < 0 || cut < best_cut ) {
+            best_cut = cut;
+            side.swap(trial);
+        }
+    }
+    if ( n == 0 ) side.clear();
+}
+
+void
+SSTMultilevelPartition::refine(const Graph& graph, double fraction, vector<uint8_t>& side)
+{
+    uint32_t n        = graph.size();
+    double   total    = 0;
+    double   max_vwgt = 0;
+    for ( double w : graph.vwgt ) {
+        total += w;
+        if ( w > max_vwgt ) max_vwgt = w;
+    }
+    double target    = fraction * total;
+    double tolerance = MULTILEVEL_IMBALANCE * (target < total - target ? target : total - target);
+    if ( tolerance < max_vwgt / 2 ) tolerance = max_vwgt / 2;
+
+    double weight0 = 0;
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( side[v] == 0 ) weight0 += graph.vwgt[v];
+    }
+
+    vector<double>   gain(n);
+    vector<uint8_t>  locked(n);
+    vector<uint32_t> moves;
+    for ( int pass = 0; pass < MULTILEVEL_REFINE_PASSES; pass++ ) {
+        // Gain is the reduction in cut weight from moving a vertex
+        priority_queue<pair<double, uint32_t>> queue[2];
+        bool                                   balanced = fabs(weight0 - target) <= tolerance;
+        for ( uint32_t v = 0; v < n; v++ ) {
+            gain[v]       = 0;
+            locked[v]     = 0;
+            bool boundary = false;
+            for ( uint32_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+                if ( side[graph.adj[j]] != side[v] ) {
+                    gain[v] += graph.ewgt[j];
+                    boundary = true;
+                }
+                else {
+                    gain[v] -= graph.ewgt[j];
+                }
+            }
+            // Interior vertices are only useful for fixing the balance
+            if ( boundary || !balanced ) queue[side[v]].emplace(gain[v], v);
+        }
+
+        double cut       = cutWeight(graph, side);
+        double best_cut  = cut;
+        double best_dev  = fabs(weight0 - target);
+        bool   best_ok   = best_dev <= tolerance;
+        size_t best_move = 0;
+        size_t idle      = 0;
+        size_t max_idle  = 50 + n / 20;
+        moves.clear();
+
+        while ( idle < max_idle ) {
+            // Find the best allowed move out of each side
+            uint32_t candidate[2] = { UNMATCHED, UNMATCHED };
+            for ( int s = 0; s < 2; s++ ) {
+                while ( !queue[s].empty() ) {
+                    auto     top = queue[s].top();
+                    uint32_t v   = top.second;
+                    if ( locked[v] || side[v] != s || top.first != gain[v] ) {
+                        queue[s].pop();
+                        continue;
+                    }
+                    double new_weight0 = s == 0 ? weight0 - graph.vwgt[v] : weight0 + graph.vwgt[v];
+                    double dev         = fabs(weight0 - target);
+                    double new_dev     = fabs(new_weight0 - target);
+                    if ( new_dev <= tolerance || new_dev < dev ) candidate[s] = v;
+                    break;
+                }
+            }
+            uint32_t v;
+            if ( candidate[0] == UNMATCHED && candidate[1] == UNMATCHED ) break;
+            if ( candidate[1] == UNMATCHED ) { v = candidate[0]; }
+            else if ( candidate[0] == UNMATCHED ) {
+                v = candidate[1];
+            }
+            else {
+                v = gain[candidate[0]] >= gain[candidate[1]] ? candidate[0] : candidate[1];
+            }
+            queue[side[v]].pop();
+
+            // Move it
+            weight0 += side[v] == 0 ? -graph.vwgt[v] : graph.vwgt[v];
+            side[v]   = 1 - side[v];
+            locked[v] = 1;
+            cut -= gain[v];
+            gain[v] = -gain[v];
+            moves.push_back(v);
+            for ( uint32_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+                uint32_t u = graph.adj[j];
+                gain[u] += side[u] == side[v] ? -2 * graph.ewgt[j] : 2 * graph.ewgt[j];
+                if ( !locked[u] ) queue[side[u]].emplace(gain[u], u);
+            }
+
+            // Keep track of the best point seen, preferring balance,
+            // then a smaller cut, then a smaller deviation
+            double dev    = fabs(weight0 - target);
+            bool   ok     = dev <= tolerance;
+            bool   better = false;
+            if ( ok && !best_ok )
+                better = true;
+            else if ( ok == best_ok ) {
+                if ( ok )
+                    better = cut < best_cut - 1e-9 || (cut <= best_cut + 1e-9 && dev < best_dev);
+                else
+                    better = dev < best_dev;
+            }
+            if ( better ) {
+                best_cut  = cut;
+                best_dev  = dev;
+                best_ok   = ok;
+                best_move = moves.size();
+                idle      = 0;
+            }
+            else {
+                idle++;
+            }
+        }
+
+        // Undo everything after the best point
+        for ( size_t i = moves.size(); i > best_move; i-- ) {
+            uint32_t v = moves[i - 1];
+            weight0 += side[v] == 0 ? -graph.vwgt[v] : graph.vwgt[v];
+            side[v] = 1 - side[v];
+        }
+
+        if ( best_move == 0 ) break;
+    }
+}
+
+void
+SSTMultilevelPartition::subgraph(
+    const Graph& graph, const vector<uint8_t>& side, uint8_t which, Graph& sub, vector<uint32_t>& vmap)
+{
+    uint32_t         n = graph.size();
+    vector<uint32_t> index(n, UNMATCHED);
+    vmap.clear();
+    for ( uint32_t v = 0; v < n; v++ ) {
+        if ( side[v] != which ) continue;
+        index[v] = vmap.size();
+        vmap.push_back(v);
+    }
+
+    sub.xadj.assign(1, 0);
+    sub.adj.clear();
+    sub.ewgt.clear();
+    sub.vwgt.clear();
+    for ( uint32_t v : vmap ) {
+        sub.vwgt.push_back(graph.vwgt[v]);
+        for ( uint32_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+            uint32_t u = index[graph.adj[j]];
+            if ( u == UNMATCHED ) continue;
+            sub.adj.push_back(u);
+            sub.ewgt.push_back(graph.ewgt[j]);
+        }
+        sub.xadj.push_back(sub.adj.size());
+    }
+}
+
+double
+SSTMultilevelPartition::cutWeight(const Graph& graph, const vector<uint8_t>& side)
+{
+    double cut = 0;
+    for ( uint32_t v = 0; v < graph.size(); v++ ) {
+        for ( uint32_t j = graph.xadj[v]; j < graph.xadj[v + 1]; j++ ) {
+            if ( side[graph.adj[j]] != side[v] ) cut += graph.ewgt[j];
+        }
+    }
+    return cut / 2;
+}
+
+void
+SSTMultilevelPartition::randomOrder(uint32_t n, vector<uint32_t>& order)
+{
+    // Fisher-Yates with a fixed generator (PCG style LCG), so the
+    // partition is the same on every platform
+    order.resize(n);
+    for ( uint32_t i = 0; i < n; i++ ) {
+        order[i] = i;
+    }
+    for ( uint32_t i = n; i > 1; i-- ) {
+        random_state = random_state * 6364136223846793005ULL + 1442695040888963407ULL;
+        uint32_t j   = (random_state >> 33) % i;
+        uint32_t tmp = order[i - 1];
+        order[i - 1] = order[j];
+        order[j]     = tmp;
+    }
+}
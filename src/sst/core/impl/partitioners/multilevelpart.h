@@ -0,0 +1,155 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+#define SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/sstpart.h"
+
+#include <string>
+#include <vector>
+
+namespace SST {
+
+class Output;
+class PartitionComponent;
+class PartitionLink;
+
+namespace IMPL {
+namespace Partition {
+
+/**
+Performs a multilevel recursive bisection of an SST simulation
+configuration.  The parts (one per rank and thread) are split in two
+recursively; the ranks are split before the threads within a rank.
+Each bisection coarsens the graph by collapsing heavy edges until it is
+small, bisects the coarsest graph by greedy graph growing, then projects
+the bisection back through the levels, refining it with
+Fiduccia-Mattheyses passes at each one.
+
+Components are balanced by their weight and the number of cut links is
+minimized.  Groups of components joined by no-cut links are collapsed
+into a single vertex before partitioning, so they are never split.
+*/
+class SSTMultilevelPartition : public SST::Partition::SSTPartitioner
+{
+
+public:
+    SST_ELI_REGISTER_PARTITIONER(
+        SSTMultilevelPartition,
+        "sst",
+        "multilevel",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Multilevel recursive bisection (heavy edge coarsening, greedy initial bisection and Fiduccia-Mattheyses "
+        "refinement) that minimizes the number of cut links while balancing component weights.")
+
+    /**
+       Creates a new multilevel partition scheme.
+       \param rankCount Number of ranks and threads in the simulation
+       \param verbosity The level of information to output
+    */
+    SSTMultilevelPartition(RankInfo rankCount, RankInfo my_rank, int verbosity);
+    ~SSTMultilevelPartition();
+
+    /**
+       Performs a partition of an SST simulation configuration
+       \param graph The simulation configuration to partition
+    */
+    void performPartition(PartitionGraph* graph) override;
+
+    bool requiresConfigGraph() override { return false; }
+    bool spawnOnAllRanks() override { return false; }
+
+protected:
+    SSTMultilevelPartition(RankInfo rankCount, RankInfo my_rank, int verbosity, const std::string& prefix);
+
+    /** Weighted, undirected graph in compressed sparse row form */
+    struct Graph
+    {
+        // Edges of vertex v are [xadj[v], xadj[v+1]) in adj and ewgt
+        std::vector<uint32_t> xadj;
+        std::vector<uint32_t> adj;
+        std::vector<double>   ewgt;
+        std::vector<double>   vwgt;
+
+        uint32_t size() const { return vwgt.size(); }
+    };
+
+    /** A link between two vertices */
+    struct Edge
+    {
+        uint32_t             end[2];
+        const PartitionLink* link;
+        double               weight;
+    };
+
+    /** Cost of cutting a link.  This is the link's weight, which is 1
+     * unless set from a profile with --partition-weights. */
+    virtual double getLinkWeight(const PartitionLink& link);
+
+    /** Get the components of pgraph and the links between them, as
+     * indices into comps */
+    void getEdges(PartitionGraph* pgraph, std::vector<PartitionComponent*>& comps, std::vector<Edge>& edges);
+
+    /** Build a graph, merging parallel edges */
+    void buildGraph(const std::vector<double>& vwgt, const std::vector<Edge>& edges, Graph& graph);
+
+    /** Split graph into one part per rank and thread, numbered rank * threads + thread */
+    void partitionGraph(const Graph& graph, std::vector<uint32_t>& parts);
+
+    /** Print the cut and the balance of a partition */
+    void report(const Graph& graph, const std::vector<uint32_t>& parts);
+
+    /** Number of the parts [first_part, first_part + num_parts) to put
+     * on the first side of a bisection */
+    virtual uint32_t splitParts(uint32_t first_part, uint32_t num_parts);
+
+    /** Number of ranks and threads in the simulation */
+    RankInfo rankcount;
+    /** Output object to print partitioning information */
+    Output*  partOutput;
+
+private:
+    /** Split the vertices of graph (ids into the top level graph) into num_parts parts */
+    void partition(
+        const Graph& graph, const std::vector<uint32_t>& ids, uint32_t first_part, uint32_t num_parts,
+        std::vector<uint32_t>& parts);
+
+    /** Bisect graph so that fraction of the vertex weight is on side 0 */
+    void bisect(const Graph& graph, double fraction, std::vector<uint8_t>& side);
+
+    /** Collapse a heavy edge matching of fine into coarse */
+    void coarsen(const Graph& fine, Graph& coarse, std::vector<uint32_t>& cmap);
+
+    /** Greedy graph growing bisection, used on the coarsest graph */
+    void initialBisection(const Graph& graph, double fraction, std::vector<uint8_t>& side);
+
+    /** Fiduccia-Mattheyses refinement of a bisection */
+    void refine(const Graph& graph, double fraction, std::vector<uint8_t>& side);
+
+    /** Get the part of graph on one side of a bisection */
+    void subgraph(
+        const Graph& graph, const std::vector<uint8_t>& side, uint8_t which, Graph& sub, std::vector<uint32_t>& vmap);
+
+    double cutWeight(const Graph& graph, const std::vector<uint8_t>& side);
+
+    /** Deterministic pseudo-random order of n vertices */
+    void randomOrder(uint32_t n, std::vector<uint32_t>& order);
+
+    uint64_t random_state;
+};
+
+} // namespace Partition
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_PARTITONERS_MULTILEVELPART_H
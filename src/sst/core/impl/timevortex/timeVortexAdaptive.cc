@@ -0,0 +1,246 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexAdaptive.h"
+
+#include "sst/core/factory.h"
+#include "sst/core/output.h"
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexAdaptiveBase<TS>::TimeVortexAdaptiveBase(Params& params) :
+    TimeVortex(),
+    params(params),
+    pops(0),
+    distinct_times(0),
+    last_pop_time(MAX_SIMTIME_T),
+    num_switches(0),
+    max_depth(0),
+    current_depth(0)
+{
+    heap_type               = params.find<std::string>("heap", "sst.timevortex.dary_heap");
+    calendar_type           = params.find<std::string>("calendar", "sst.timevortex.ladder");
+    std::string initial     = params.find<std::string>("initial", "heap");
+    calendar_depth          = params.find<uint64_t>("calendar_depth", 4096);
+    heap_depth              = params.find<uint64_t>("heap_depth", 1024);
+    check_interval          = params.find<uint64_t>("check_interval", 4096);
+
+    Output& out = Output::getDefaultObject();
+    if ( heap_depth >= calendar_depth ) {
+        out.fatal(
+            CALL_INFO, 1, "ERROR: TimeVortexAdaptive: heap_depth (%" PRIu64 ") must be less than calendar_depth (%" PRIu64
+            ")\n", heap_depth, calendar_depth);
+    }
+    if ( check_interval == 0 ) out.fatal(CALL_INFO, 1, "ERROR: TimeVortexAdaptive: check_interval must be non-zero\n");
+    if ( initial != "heap" && initial != "calendar" ) {
+        out.fatal(
+            CALL_INFO, 1, "ERROR: TimeVortexAdaptive: initial must be heap or calendar, found %s\n", initial.c_str());
+    }
+
+    using_heap = initial == "heap";
+    active     = create(using_heap ? heap_type : calendar_type);
+}
+
+template <bool TS>
+TimeVortexAdaptiveBase<TS>::~TimeVortexAdaptiveBase()
+{
+    // The wrapped TimeVortex deletes any Activities it still holds
+    delete active;
+}
+
+template <bool TS>
+bool
+TimeVortexAdaptiveBase<TS>::empty()
+{
+    return current_depth == 0;
+}
+
+template <bool TS>
+int
+TimeVortexAdaptiveBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    active->insert(activity);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::insertBatch(Activity* const* activities, size_t count)
+{
+    if ( TS ) slock.lock();
+    active->insertBatch(activities, count);
+    current_depth += count;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexAdaptiveBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    Activity* ret_val = active->pop();
+    if ( ret_val != nullptr ) {
+        current_depth--;
+        popped(ret_val->getDeliveryTime(), 1);
+    }
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexAdaptiveBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    Activity* ret = active->front();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+size_t
+TimeVortexAdaptiveBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) slock.lock();
+    size_t count = active->popBatch(batch);
+    if ( count > 0 ) {
+        current_depth -= count;
+        popped(batch.back()->getDeliveryTime(), count);
+    }
+    if ( TS ) slock.unlock();
+    return count;
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::print(Output& out) const
+{
+    out.output(
+        "TimeVortexAdaptive: using %s, %" PRIu64 " switches\n", using_heap ? "heap" : "calendar", num_switches);
+    active->print(out);
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::checkMode()
+{
+    // Depth weighted by the number of activities popped per distinct
+    // delivery time.  Heaps pay for every activity, while calendars
+    // handle activities with the same time together.  All the pops can
+    // be at the time of the last pop before the previous check, in
+    // which case no new distinct time was seen.
+    uint64_t weighted = current_depth * pops / (distinct_times > 0 ? distinct_times : 1);
+    pops              = 0;
+    distinct_times    = 0;
+
+    if ( using_heap ) {
+        if ( weighted >= calendar_depth ) migrate();
+    }
+    else {
+        if ( weighted < heap_depth ) migrate();
+    }
+}
+
+template <bool TS>
+void
+TimeVortexAdaptiveBase<TS>::migrate()
+{
+    // Always start from a fresh TimeVortex.  Some implementations
+    // (e.g. TimeVortexBinnedMap) assume time never goes backwards, so
+    // can't be refilled with earlier activities once drained.
+    using_heap         = !using_heap;
+    TimeVortex* target = create(using_heap ? heap_type : calendar_type);
+
+    // Inserting in pop order gives the activities new queue orders
+    // with the same relative order, so ties still come out in the
+    // order they went in
+    Activity* act;
+    while ( (act = active->pop()) != nullptr )
+        target->insert(act);
+    delete active;
+    active = target;
+    num_switches++;
+}
+
+template <bool TS>
+TimeVortex*
+TimeVortexAdaptiveBase<TS>::create(const std::string& type)
+{
+    // The wrapped TimeVortex is only touched with our lock held, so
+    // never needs to be thread safe itself
+    TimeVortex* ret = Factory::getFactory()->Create<TimeVortex>(type, params);
+    if ( ret == nullptr ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Unable to create TimeVortex %s for TimeVortexAdaptive\n", type.c_str());
+    }
+    return ret;
+}
+
+
+class TimeVortexAdaptive : public TimeVortexAdaptiveBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexAdaptive,
+        "sst",
+        "timevortex.adaptive",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex that moves its contents between a heap and a calendar queue based on the depth of the queue and how clustered the delivery times are.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"heap",           "TimeVortex used for shallow queues",                                                    "sst.timevortex.dary_heap"},
+        {"calendar",       "TimeVortex used for deep or clustered queues",                                          "sst.timevortex.ladder"},
+        {"initial",        "Representation to start with: heap or calendar",                                        "heap"},
+        {"calendar_depth", "Switch to the calendar when depth times activities per distinct time reaches this",     "4096"},
+        {"heap_depth",     "Switch back to the heap when depth times activities per distinct time drops below this", "1024"},
+        {"check_interval", "Number of pops between checks of the thresholds",                                       "4096"}
+    )
+
+    TimeVortexAdaptive(Params& params) : TimeVortexAdaptiveBase<false>(params) {}
+    ~TimeVortexAdaptive() {}
+    SST_ELI_EXPORT(TimeVortexAdaptive)
+};
+
+class TimeVortexAdaptive_ts : public TimeVortexAdaptiveBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexAdaptive_ts,
+        "sst",
+        "timevortex.adaptive.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex that switches between a heap and a calendar queue.  Do not reference this element directly, just specify sst.timevortex.adaptive and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexAdaptive_ts(Params& params) : TimeVortexAdaptiveBase<true>(params) {}
+    ~TimeVortexAdaptive_ts() {}
+    SST_ELI_EXPORT(TimeVortexAdaptive_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,119 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXADAPTIVE_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXADAPTIVE_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <string>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue that switches between a heap and a calendar
+ * (bucketed) TimeVortex as the simulation runs.  Every check_interval
+ * pops, the queue depth is weighted by how clustered the delivery
+ * times were over the interval (activities popped per distinct
+ * delivery time).  Deep or heavily clustered queues move to the
+ * calendar, shallow and sparse ones move back to the heap.  The two
+ * thresholds are kept apart so the queue doesn't bounce between
+ * representations.
+ *
+ * Switching pops everything out of the active TimeVortex and inserts
+ * it into a new one of the other kind in pop order.  The new
+ * insertion order keeps the relative order of ties, and anything
+ * inserted afterwards is ordered after everything that was migrated,
+ * so the order activities come out in is exactly the same as if no
+ * switch had happened.
+ */
+template <bool TS>
+class TimeVortexAdaptiveBase : public TimeVortex, public Core::ThreadSafe::CacheAlignedNew
+{
+
+public:
+    TimeVortexAdaptiveBase(Params& params);
+    ~TimeVortexAdaptiveBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity* const* activities, size_t count) override;
+    Activity* pop() override;
+    Activity* front() override;
+    size_t    popBatch(std::vector<Activity*>& batch) override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    /** Account for count activities popped at the given time */
+    inline void popped(SimTime_t time, uint64_t count)
+    {
+        if ( time != last_pop_time ) {
+            distinct_times++;
+            last_pop_time = time;
+        }
+        pops += count;
+        if ( UNLIKELY(pops >= check_interval) ) checkMode();
+    }
+
+    /** Switch representations if the thresholds say to */
+    void checkMode();
+
+    /** Move everything into a new TimeVortex of the other kind */
+    void migrate();
+
+    TimeVortex* create(const std::string& type);
+
+    TimeVortex* active;
+    bool        using_heap;
+    std::string heap_type;
+    std::string calendar_type;
+    // Passed on to the wrapped TimeVortices
+    Params      params;
+
+    // Thresholds on the queue depth weighted by clustering
+    uint64_t calendar_depth;
+    uint64_t heap_depth;
+    uint64_t check_interval;
+
+    // Pop stats since the last check
+    uint64_t  pops;
+    uint64_t  distinct_times;
+    SimTime_t last_pop_time;
+
+    uint64_t num_switches;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXADAPTIVE_H
@@ -0,0 +1,237 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexDHeap.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation.h"
+
+namespace SST {
+namespace IMPL {
+
+template <bool TS>
+TimeVortexDHeapBase<TS>::TimeVortexDHeapBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    insertOrder(0),
+    max_depth(0),
+    current_depth(0)
+{}
+
+template <bool TS>
+TimeVortexDHeapBase<TS>::~TimeVortexDHeapBase()
+{
+    // Activities in TimeVortexDHeap all need to be deleted
+    for ( auto& entry : data ) {
+        delete entry.activity;
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexDHeapBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.empty();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexDHeapBase<TS>::size()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.size();
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    push(activity);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::insertBatch(Activity* const* activities, size_t count)
+{
+    if ( TS ) slock.lock();
+    data.reserve(data.size() + count);
+    for ( size_t i = 0; i < count; ++i )
+        push(activities[i]);
+    current_depth += count;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexDHeapBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( data.empty() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = data.front().activity;
+    Entry     last    = data.back();
+    data.pop_back();
+    if ( !data.empty() ) siftDown(0, last);
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexDHeapBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    auto ret = data.empty() ? nullptr : data.front().activity;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+size_t
+TimeVortexDHeapBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) slock.lock();
+    size_t count = 0;
+    if ( !data.empty() ) {
+        // Priority is the upper half of priority_order
+        SimTime_t time     = data.front().time;
+        uint64_t  priority = data.front().priority_order >> 32;
+        do {
+            batch.push_back(data.front().activity);
+            Entry last = data.back();
+            data.pop_back();
+            if ( !data.empty() ) siftDown(0, last);
+            count++;
+        } while ( !data.empty() && data.front().time == time && (data.front().priority_order >> 32) == priority );
+        current_depth -= count;
+    }
+    if ( TS ) slock.unlock();
+    return count;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+
+    for ( auto& entry : data ) {
+        entry.activity->print("  ", out);
+    }
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::push(Activity* activity)
+{
+    activity->setQueueOrder(insertOrder++);
+    Entry entry;
+    entry.time           = activity->getDeliveryTime();
+    entry.priority_order = ((uint64_t)(uint32_t)activity->getPriority() << 32) | activity->getOrderTag();
+    entry.queue_order    = activity->getQueueOrder();
+    entry.activity       = activity;
+    data.emplace_back();
+    siftUp(data.size() - 1, entry);
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::siftUp(size_t hole, const Entry& entry)
+{
+    // Move parents down into the hole until we find where entry goes
+    while ( hole > 0 ) {
+        size_t parent = (hole - 1) / arity;
+        if ( !(entry < data[parent]) ) break;
+        data[hole] = data[parent];
+        hole       = parent;
+    }
+    data[hole] = entry;
+}
+
+template <bool TS>
+void
+TimeVortexDHeapBase<TS>::siftDown(size_t hole, const Entry& entry)
+{
+    // Entry is usually the last element of the heap, so it almost
+    // always belongs near the bottom.  Rather than comparing it
+    // against the children at every level, first move the hole all
+    // the way down along the path of smallest children, then sift
+    // entry back up from there.  All the children of a node are
+    // adjacent, so each level scans at most arity contiguous entries.
+    size_t count = data.size();
+    while ( true ) {
+        size_t first = arity * hole + 1;
+        if ( first >= count ) break;
+        size_t last = first + arity;
+        if ( last > count ) last = count;
+
+        size_t best = first;
+        for ( size_t child = first + 1; child < last; ++child ) {
+            if ( data[child] < data[best] ) best = child;
+        }
+        data[hole] = data[best];
+        hole       = best;
+    }
+    siftUp(hole, entry);
+}
+
+
+class TimeVortexDHeap : public TimeVortexDHeapBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDHeap,
+        "sst",
+        "timevortex.dary_heap",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a 4-ary heap which keeps the sort keys inline with the Activity pointers.")
+
+
+    TimeVortexDHeap(Params& params) : TimeVortexDHeapBase<false>(params) {}
+    ~TimeVortexDHeap() {}
+    SST_ELI_EXPORT(TimeVortexDHeap)
+};
+
+class TimeVortexDHeap_ts : public TimeVortexDHeapBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexDHeap_ts,
+        "sst",
+        "timevortex.dary_heap.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on a 4-ary heap.  Do not reference this element directly, just specify sst.timevortex.dary_heap and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexDHeap_ts(Params& params) : TimeVortexDHeapBase<true>(params) {}
+    ~TimeVortexDHeap_ts() {}
+    SST_ELI_EXPORT(TimeVortexDHeap_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,96 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue implemented as a 4-ary heap.  The sort key of
+ * each Activity is copied into the heap next to the pointer, so heap
+ * maintenance only touches the (contiguous) heap array and never
+ * dereferences the Activities themselves.
+ */
+template <bool TS>
+class TimeVortexDHeapBase : public TimeVortex, public Core::ThreadSafe::CacheAlignedNew
+{
+
+public:
+    TimeVortexDHeapBase(Params& params);
+    ~TimeVortexDHeapBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity* const* activities, size_t count) override;
+    Activity* pop() override;
+    Activity* front() override;
+    size_t    popBatch(std::vector<Activity*>& batch) override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    static const size_t arity = 4;
+
+    // Inline copy of the Activity sort key.  Same ordering as
+    // Activity::less<true, true, true>.
+    struct Entry
+    {
+        SimTime_t time;
+        uint64_t  priority_order;
+        uint64_t  queue_order;
+        Activity* activity;
+
+        inline bool operator<(const Entry& rhs) const
+        {
+            if ( time != rhs.time ) return time < rhs.time;
+            if ( priority_order != rhs.priority_order ) return priority_order < rhs.priority_order;
+            return queue_order < rhs.queue_order;
+        }
+    };
+
+    void push(Activity* activity);
+    void siftUp(size_t hole, const Entry& entry);
+    void siftDown(size_t hole, const Entry& entry);
+
+    // Data
+    std::vector<Entry> data;
+    uint64_t           insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXDHEAP_H
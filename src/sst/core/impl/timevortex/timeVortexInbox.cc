@@ -0,0 +1,146 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexInbox.h"
+
+#include "sst/core/factory.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation_impl.h"
+
+namespace SST {
+namespace IMPL {
+
+TimeVortexInbox::TimeVortexInbox(Params& params) : TimeVortex(), pending(false)
+{
+    std::string type = params.find<std::string>("vortex", "sst.timevortex.priority_queue");
+    int         num_threads = params.find<int>("num_threads", 1);
+    owner                   = params.find<int>("thread", 0);
+
+    vortex = Factory::getFactory()->Create<TimeVortex>(type, params);
+    if ( vortex == nullptr ) {
+        Output::getDefaultObject().fatal(
+            CALL_INFO, 1, "ERROR: Unable to create TimeVortex %s for TimeVortexInbox\n", type.c_str());
+    }
+
+    inboxes.resize(num_threads, nullptr);
+    for ( int i = 0; i < num_threads; ++i ) {
+        if ( i != owner ) inboxes[i] = new Inbox();
+    }
+}
+
+TimeVortexInbox::~TimeVortexInbox()
+{
+    // Activities still in the inboxes need to be deleted, the wrapped
+    // TimeVortex deletes its own
+    Activity* act;
+    for ( auto inbox : inboxes ) {
+        if ( inbox == nullptr ) continue;
+        while ( inbox->try_remove(act) )
+            delete act;
+        delete inbox;
+    }
+    delete vortex;
+}
+
+bool
+TimeVortexInbox::empty()
+{
+    drain();
+    return vortex->empty();
+}
+
+int
+TimeVortexInbox::size()
+{
+    drain();
+    return vortex->size();
+}
+
+void
+TimeVortexInbox::insert(Activity* activity)
+{
+    int thread = getInsertingThread();
+    if ( thread == owner ) {
+        vortex->insert(activity);
+        return;
+    }
+    inboxes[thread]->insert(activity);
+    // Needs to be a read-modify-write so that the owner's exchange
+    // synchronizes with every producer that set the flag, not just
+    // the last one
+    pending.exchange(true, std::memory_order_release);
+}
+
+void
+TimeVortexInbox::insertBatch(Activity* const* activities, size_t count)
+{
+    int thread = getInsertingThread();
+    if ( thread == owner ) {
+        vortex->insertBatch(activities, count);
+        return;
+    }
+    for ( size_t i = 0; i < count; ++i )
+        inboxes[thread]->insert(activities[i]);
+    pending.exchange(true, std::memory_order_release);
+}
+
+Activity*
+TimeVortexInbox::pop()
+{
+    drain();
+    return vortex->pop();
+}
+
+Activity*
+TimeVortexInbox::front()
+{
+    drain();
+    return vortex->front();
+}
+
+size_t
+TimeVortexInbox::popBatch(std::vector<Activity*>& batch)
+{
+    drain();
+    return vortex->popBatch(batch);
+}
+
+void
+TimeVortexInbox::print(Output& out) const
+{
+    vortex->print(out);
+}
+
+void
+TimeVortexInbox::drainInboxes()
+{
+    Activity* act;
+    for ( auto inbox : inboxes ) {
+        if ( inbox == nullptr ) continue;
+        while ( inbox->try_remove(act) )
+            vortex->insert(act);
+    }
+}
+
+int
+TimeVortexInbox::getInsertingThread()
+{
+    // Looking up the Simulation object is a map lookup, so only do it
+    // once per thread
+    static thread_local int thread = -1;
+    if ( UNLIKELY(thread == -1) ) thread = Simulation_impl::getSimulation()->getRank().thread;
+    return thread;
+}
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,106 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXINBOX_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXINBOX_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Thread safe TimeVortex for use with interthread links.  Wraps a
+ * non-thread safe TimeVortex that is only ever touched by the owning
+ * thread.  Every other thread gets its own lock-free inbox to insert
+ * into, and the owning thread drains all the inboxes into the wrapped
+ * TimeVortex before it looks at the head of the queue.
+ *
+ * Events sent across threads are always at least one thread sync
+ * period in the future, and the thread sync barrier orders all the
+ * inserts of one period before the pops of the next, so draining at
+ * pop time never delivers an event late.
+ */
+class TimeVortexInbox : public TimeVortex, public Core::ThreadSafe::CacheAlignedNew
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexInbox,
+        "sst",
+        "timevortex.inbox",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe TimeVortex that gives each inserting thread a lock-free inbox, which the owning thread drains into a private TimeVortex.  Do not reference this element directly, it is selected by the --interthread-inbox option.")
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"vortex",      "TimeVortex used to hold the activities of the owning thread", "sst.timevortex.priority_queue"},
+        {"num_threads", "Number of threads that can insert into the TimeVortex",       "1"},
+        {"thread",      "Thread that owns the TimeVortex",                              "0"}
+    )
+
+    TimeVortexInbox(Params& params);
+    ~TimeVortexInbox();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity* const* activities, size_t count) override;
+    Activity* pop() override;
+    Activity* front() override;
+    size_t    popBatch(std::vector<Activity*>& batch) override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    /** Activities still sitting in an inbox are not included */
+    uint64_t getCurrentDepth() const override { return vortex->getCurrentDepth(); }
+    uint64_t getMaxDepth() const override { return vortex->getMaxDepth(); }
+
+    SST_ELI_EXPORT(TimeVortexInbox)
+
+private:
+    typedef Core::ThreadSafe::SPSCQueue<Activity*> Inbox;
+
+    /** Move everything waiting in the inboxes into vortex */
+    inline void drain()
+    {
+        if ( !pending.load(std::memory_order_relaxed) ) return;
+        if ( !pending.exchange(false, std::memory_order_acquire) ) return;
+        drainInboxes();
+    }
+
+    void drainInboxes();
+
+    /** Thread number of the calling thread */
+    static int getInsertingThread();
+
+    TimeVortex*         vortex;
+    int                 owner;
+    // One inbox per thread, indexed by thread number.  The inbox of
+    // the owning thread is never used.
+    std::vector<Inbox*> inboxes;
+
+    // Set whenever any inbox may be non-empty
+    CACHE_ALIGNED(std::atomic<bool>, pending);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXINBOX_H
@@ -0,0 +1,382 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/impl/timevortex/timeVortexLadder.h"
+
+#include "sst/core/clock.h"
+#include "sst/core/output.h"
+#include "sst/core/simulation.h"
+
+#include <algorithm>
+
+namespace SST {
+namespace IMPL {
+
+// Full ordering used for the bottom tier
+static Activity::less<true, true, true> ladder_less;
+
+template <bool TS>
+TimeVortexLadderBase<TS>::TimeVortexLadderBase(Params& UNUSED(params)) :
+    TimeVortex(),
+    top_start(0),
+    top_min(MAX_SIMTIME_T),
+    top_max(0),
+    top_closed(false),
+    nrungs(0),
+    bottom_head(0),
+    bottom_limit(bottom_threshold),
+    insertOrder(0),
+    max_depth(0),
+    current_depth(0)
+{
+    // One extra rung is needed as scratch space when an exhausted
+    // rung is replaced by a finer one
+    rungs.resize(max_rungs + 1);
+}
+
+template <bool TS>
+TimeVortexLadderBase<TS>::~TimeVortexLadderBase()
+{
+    // Activities in TimeVortexLadder all need to be deleted
+    for ( auto x : top ) {
+        delete x;
+    }
+    for ( auto& rung : rungs ) {
+        for ( auto& bucket : rung.buckets ) {
+            for ( auto x : bucket ) {
+                delete x;
+            }
+        }
+    }
+    for ( size_t i = bottom_head; i < bottom.size(); ++i ) {
+        delete bottom[i];
+    }
+}
+
+template <bool TS>
+bool
+TimeVortexLadderBase<TS>::empty()
+{
+    if ( TS ) slock.lock();
+    bool ret = current_depth == 0;
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+int
+TimeVortexLadderBase<TS>::size()
+{
+    return current_depth;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insert(Activity* activity)
+{
+    if ( TS ) slock.lock();
+    activity->setQueueOrder(insertOrder++);
+    insertActivity(activity);
+    current_depth++;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insertBatch(Activity* const* activities, size_t count)
+{
+    if ( TS ) slock.lock();
+    for ( size_t i = 0; i < count; ++i ) {
+        activities[i]->setQueueOrder(insertOrder++);
+        insertActivity(activities[i]);
+    }
+    current_depth += count;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::pop()
+{
+    if ( TS ) slock.lock();
+    if ( bottom.empty() ) fillBottom();
+    if ( bottom.empty() ) {
+        if ( TS ) slock.unlock();
+        return nullptr;
+    }
+    Activity* ret_val = bottom[bottom_head++];
+    if ( bottom_head == bottom.size() ) {
+        bottom.clear();
+        bottom_head = 0;
+    }
+    current_depth--;
+    if ( TS ) slock.unlock();
+    return ret_val;
+}
+
+template <bool TS>
+Activity*
+TimeVortexLadderBase<TS>::front()
+{
+    if ( TS ) slock.lock();
+    if ( bottom.empty() ) fillBottom();
+    Activity* ret = bottom.empty() ? nullptr : bottom[bottom_head];
+    if ( TS ) slock.unlock();
+    return ret;
+}
+
+template <bool TS>
+size_t
+TimeVortexLadderBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) slock.lock();
+    if ( bottom.empty() ) fillBottom();
+    size_t count = 0;
+    if ( !bottom.empty() ) {
+        SimTime_t time     = bottom[bottom_head]->getDeliveryTime();
+        int       priority = bottom[bottom_head]->getPriority();
+        // The bottom tier is sorted, so the batch is a run at its head
+        while ( true ) {
+            Activity* act = bottom[bottom_head];
+            if ( act->getDeliveryTime() != time || act->getPriority() != priority ) break;
+            batch.push_back(act);
+            count++;
+            if ( ++bottom_head == bottom.size() ) {
+                bottom.clear();
+                bottom_head = 0;
+                fillBottom();
+                if ( bottom.empty() ) break;
+            }
+        }
+        current_depth -= count;
+    }
+    if ( TS ) slock.unlock();
+    return count;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::print(Output& out) const
+{
+    out.output("TimeVortex state:\n");
+    out.output("  top: %zu activities\n", top.size());
+    for ( size_t i = 0; i < nrungs; ++i ) {
+        const Rung& rung = rungs[i];
+        out.output(
+            "  rung %zu: start = %" PRIu64 ", bucket width = %" PRIu64 ", %zu of %zu buckets remaining\n", i,
+            rung.start, rung.width, rung.nbuckets - rung.cur, rung.nbuckets);
+    }
+    out.output("  bottom: %zu activities\n", bottom.size() - bottom_head);
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::insertActivity(Activity* activity)
+{
+    SimTime_t time = activity->getDeliveryTime();
+
+    if ( !top_closed && time >= top_start ) {
+        if ( time < top_min ) top_min = time;
+        if ( time > top_max ) top_max = time;
+        top.push_back(activity);
+        return;
+    }
+
+    // Rungs get finer (and earlier) with increasing index, so the
+    // first one whose unconsumed range covers the time is the right
+    // one
+    for ( size_t i = 0; i < nrungs; ++i ) {
+        if ( time >= rungs[i].getCurrentStart() ) {
+            rungs[i].insert(activity, time);
+            return;
+        }
+    }
+
+    // Earlier than anything left in the rungs, so it goes into the
+    // sorted bottom tier.  New activities are usually later than what
+    // is already there, so this is normally close to an append.
+    auto it = std::upper_bound(bottom.begin() + bottom_head, bottom.end(), activity, ladder_less);
+    bottom.insert(it, activity);
+
+    // If the bottom tier has grown too large (which happens when
+    // everything above it is already spread into rungs), turn it into
+    // a new rung
+    size_t count = bottom.size() - bottom_head;
+    if ( UNLIKELY(count > bottom_limit) && nrungs < max_rungs ) {
+        SimTime_t min_time = bottom[bottom_head]->getDeliveryTime();
+        SimTime_t max_time = bottom.back()->getDeliveryTime();
+        if ( min_time != max_time ) {
+            spreadIntoRung(bottom, bottom_head, min_time, max_time, rungs[nrungs]);
+            nrungs++;
+            bottom_head  = 0;
+            bottom_limit = bottom_threshold;
+        }
+    }
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::fillBottom()
+{
+    while ( true ) {
+        if ( nrungs == 0 ) {
+            if ( top.empty() ) {
+                // Queue is empty, so we can start over
+                top_start  = 0;
+                top_closed = false;
+                return;
+            }
+
+            SimTime_t min_time = top_min;
+            SimTime_t max_time = top_max;
+            top_min            = MAX_SIMTIME_T;
+            top_max            = 0;
+            closeTop(max_time);
+
+            if ( top.size() <= bucket_threshold || min_time == max_time ) {
+                sortIntoBottom(top);
+                return;
+            }
+            spreadIntoRung(top, 0, min_time, max_time, rungs[nrungs]);
+            nrungs++;
+        }
+
+        Rung& rung = rungs[nrungs - 1];
+        while ( !rung.exhausted() && rung.buckets[rung.cur].empty() )
+            rung.cur++;
+        if ( rung.exhausted() ) {
+            nrungs--;
+            continue;
+        }
+
+        std::vector<Activity*>& bucket = rung.buckets[rung.cur++];
+        if ( bucket.size() > bucket_threshold ) {
+            SimTime_t min_time = MAX_SIMTIME_T;
+            SimTime_t max_time = 0;
+            for ( auto x : bucket ) {
+                SimTime_t time = x->getDeliveryTime();
+                if ( time < min_time ) min_time = time;
+                if ( time > max_time ) max_time = time;
+            }
+
+            // Spread the bucket into a finer rung.  If this was the
+            // last bucket of the rung, the new rung simply replaces
+            // it, which keeps a long run of late inserts (which all
+            // land in the last bucket) from growing the ladder.
+            if ( min_time != max_time ) {
+                if ( rung.exhausted() ) {
+                    spreadIntoRung(bucket, 0, min_time, max_time, rungs[nrungs]);
+                    std::swap(rungs[nrungs - 1], rungs[nrungs]);
+                    continue;
+                }
+                if ( nrungs < max_rungs ) {
+                    spreadIntoRung(bucket, 0, min_time, max_time, rungs[nrungs]);
+                    nrungs++;
+                    continue;
+                }
+            }
+        }
+
+        sortIntoBottom(bucket);
+        if ( rung.exhausted() ) nrungs--;
+        return;
+    }
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::spreadIntoRung(
+    std::vector<Activity*>& src, size_t first, SimTime_t min_time, SimTime_t max_time, Rung& rung)
+{
+    size_t count = src.size() - first;
+    if ( count > max_buckets ) count = max_buckets;
+
+    rung.start    = min_time;
+    rung.width    = (max_time - min_time) / count + 1;
+    rung.nbuckets = (max_time - min_time) / rung.width + 1;
+    rung.cur      = 0;
+    if ( rung.buckets.size() < rung.nbuckets ) rung.buckets.resize(rung.nbuckets);
+
+    for ( size_t i = first; i < src.size(); ++i ) {
+        rung.insert(src[i], src[i]->getDeliveryTime());
+    }
+    src.clear();
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::sortIntoBottom(std::vector<Activity*>& src)
+{
+    std::sort(src.begin(), src.end(), ladder_less);
+    bottom.swap(src);
+    bottom_head = 0;
+    src.clear();
+    // Let the bottom tier grow to twice its filled size before
+    // spreading it out again, so the sort is amortized
+    bottom_limit = 2 * bottom.size();
+    if ( bottom_limit < bottom_threshold ) bottom_limit = bottom_threshold;
+}
+
+template <bool TS>
+void
+TimeVortexLadderBase<TS>::closeTop(SimTime_t max_time)
+{
+    // Everything up to max_time is now handled by the rungs or the
+    // bottom tier.  Nothing can be later than SST_SIMTIME_MAX, so once
+    // that is reached, the top tier stays closed until the queue
+    // empties.
+    if ( max_time == MAX_SIMTIME_T )
+        top_closed = true;
+    else
+        top_start = max_time + 1;
+}
+
+
+class TimeVortexLadder : public TimeVortexLadderBase<false>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder,
+        "sst",
+        "timevortex.ladder",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "TimeVortex based on a ladder queue, with amortized O(1) insert and pop.  Best suited to very deep queues.")
+
+
+    TimeVortexLadder(Params& params) : TimeVortexLadderBase<false>(params) {}
+    ~TimeVortexLadder() {}
+    SST_ELI_EXPORT(TimeVortexLadder)
+};
+
+class TimeVortexLadder_ts : public TimeVortexLadderBase<true>
+{
+public:
+    SST_ELI_REGISTER_DERIVED(
+        TimeVortex,
+        TimeVortexLadder_ts,
+        "sst",
+        "timevortex.ladder.ts",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Thread safe verion of TimeVortex based on a ladder queue.  Do not reference this element directly, just specify sst.timevortex.ladder and this version will be selected when it is needed based on other parameters.")
+
+
+    TimeVortexLadder_ts(Params& params) : TimeVortexLadderBase<true>(params) {}
+    ~TimeVortexLadder_ts() {}
+    SST_ELI_EXPORT(TimeVortexLadder_ts)
+};
+
+} // namespace IMPL
+} // namespace SST
@@ -0,0 +1,142 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+#define SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
+
+#include "sst/core/eli/elementinfo.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <atomic>
+#include <vector>
+
+namespace SST {
+
+class Output;
+
+namespace IMPL {
+
+/**
+ * Primary Event Queue implemented as a ladder queue (a multi-tier
+ * calendar queue).  Activities are first placed, unsorted, in the
+ * top tier.  When the bottom tier runs dry, the top tier is spread
+ * into a rung of time buckets; buckets that are still too crowded
+ * are recursively spread into finer rungs, and the first bucket that
+ * is small enough is sorted into the bottom tier.  Insert and pop
+ * are amortized O(1) independent of queue depth.
+ *
+ * Buckets are only used to partition time; the final ordering is
+ * always done on the bottom tier with the full (time,
+ * priority/order tag, queue order) key, so activities pop in the
+ * same order as with TimeVortexPQ.
+ */
+template <bool TS>
+class TimeVortexLadderBase : public TimeVortex, public Core::ThreadSafe::CacheAlignedNew
+{
+
+public:
+    TimeVortexLadderBase(Params& params);
+    ~TimeVortexLadderBase();
+
+    bool      empty() override;
+    int       size() override;
+    void      insert(Activity* activity) override;
+    void      insertBatch(Activity* const* activities, size_t count) override;
+    Activity* pop() override;
+    Activity* front() override;
+    size_t    popBatch(std::vector<Activity*>& batch) override;
+
+    /** Print the state of the TimeVortex */
+    void print(Output& out) const override;
+
+    uint64_t getCurrentDepth() const override { return current_depth; }
+    uint64_t getMaxDepth() const override { return max_depth; }
+
+private:
+    // Buckets (or top/bottom tiers) holding at most this many
+    // activities are sorted directly instead of spread into a new rung
+    static const size_t bucket_threshold = 50;
+    // Upper bound on the number of buckets in a single rung
+    static const size_t max_buckets      = 1 << 16;
+    // Upper bound on the number of rungs
+    static const size_t max_rungs        = 8;
+    // Minimum size the bottom tier may grow to before it is spread
+    // into a new rung
+    static const size_t bottom_threshold = 4 * bucket_threshold;
+
+    class Rung
+    {
+    public:
+        // Buckets beyond nbuckets are kept only to reuse their
+        // allocations
+        std::vector<std::vector<Activity*>> buckets;
+        SimTime_t                           start;
+        SimTime_t                           width;
+        size_t                              nbuckets;
+        size_t                              cur;
+
+        Rung() : start(0), width(1), nbuckets(0), cur(0) {}
+
+        /** Start time of the first bucket not yet handed down */
+        inline SimTime_t getCurrentStart() const { return start + cur * width; }
+
+        inline bool exhausted() const { return cur >= nbuckets; }
+
+        /** Insert into the bucket covering time.  The last bucket
+         * takes everything above the end of the rung. */
+        inline void insert(Activity* act, SimTime_t time)
+        {
+            size_t index = (time - start) / width;
+            if ( index >= nbuckets ) index = nbuckets - 1;
+            buckets[index].push_back(act);
+        }
+    };
+
+    void insertActivity(Activity* activity);
+    void fillBottom();
+    void spreadIntoRung(std::vector<Activity*>& src, size_t first, SimTime_t min_time, SimTime_t max_time, Rung& rung);
+    void sortIntoBottom(std::vector<Activity*>& src);
+    void closeTop(SimTime_t max_time);
+
+    // Top tier: unsorted activities above all rungs
+    std::vector<Activity*> top;
+    SimTime_t              top_start;
+    SimTime_t              top_min;
+    SimTime_t              top_max;
+    // The top tier is closed once a rung covers SST_SIMTIME_MAX
+    bool                   top_closed;
+
+    // Rungs, from coarsest (index 0) to finest.  Rungs past nrungs
+    // are kept only to reuse their allocations.
+    std::vector<Rung> rungs;
+    size_t            nrungs;
+
+    // Bottom tier: sorted, popped from bottom_head
+    std::vector<Activity*> bottom;
+    size_t                 bottom_head;
+    size_t                 bottom_limit;
+
+    uint64_t insertOrder;
+
+    // Stats about usage
+    uint64_t max_depth;
+
+    // Need current depth to be atomic if we are thread safe
+    typename std::conditional<TS, std::atomic<uint64_t>, uint64_t>::type current_depth;
+
+    CACHE_ALIGNED(SST::Core::ThreadSafe::Spinlock, slock);
+};
+
+} // namespace IMPL
+} // namespace SST
+
+#endif // SST_CORE_IMPL_TIMEVORTEX_TIMEVORTEXLADDER_H
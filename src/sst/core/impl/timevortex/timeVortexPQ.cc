@@ -71,6 +71,20 @@ TimeVortexPQBase<TS>::insert(Activity* activity)
     if ( TS ) slock.unlock();
 }
 
+template <bool TS>
+void
+TimeVortexPQBase<TS>::insertBatch(Activity* const* activities, size_t count)
+{
+    if ( TS ) slock.lock();
+    for ( size_t i = 0; i < count; ++i ) {
+        activities[i]->setQueueOrder(insertOrder++);
+        data.push(activities[i]);
+    }
+    current_depth += count;
+    if ( current_depth > max_depth ) { max_depth = current_depth; }
+    if ( TS ) slock.unlock();
+}
+
 template <bool TS>
 Activity*
 TimeVortexPQBase<TS>::pop()
@@ -94,6 +108,26 @@ TimeVortexPQBase<TS>::front()
     return ret;
 }
 
+template <bool TS>
+size_t
+TimeVortexPQBase<TS>::popBatch(std::vector<Activity*>& batch)
+{
+    if ( TS ) slock.lock();
+    size_t count = 0;
+    if ( !data.empty() ) {
+        SimTime_t time     = data.top()->getDeliveryTime();
+        int       priority = data.top()->getPriority();
+        do {
+            batch.push_back(data.top());
+            data.pop();
+            count++;
+        } while ( !data.empty() && data.top()->getDeliveryTime() == time && data.top()->getPriority() == priority );
+        current_depth -= count;
+    }
+    if ( TS ) slock.unlock();
+    return count;
+}
+
 template <bool TS>
 void
 TimeVortexPQBase<TS>::print(Output& out) const
@@ -40,8 +40,10 @@ public:
     bool      empty() override;
     int       size() override;
     void      insert(Activity* activity) override;
+    void      insertBatch(Activity* const* activities, size_t count) override;
     Activity* pop() override;
     Activity* front() override;
+    size_t    popBatch(std::vector<Activity*>& batch) override;
 
     /** Print the state of the TimeVortex */
     void print(Output& out) const override;
@@ -27,6 +27,7 @@
 #include "sst/core/unitAlgebra.h"
 
 #include <utility>
+#include <vector>
 
 namespace SST {
 
@@ -258,6 +259,44 @@ Link::send_impl(SimTime_t delay, Event* event)
     send_queue->insert(event);
 }
 
+void
+Link::sendBatch_impl(size_t count, Event* const* events, const SimTime_t* delays, SimTime_t factor)
+{
+    if ( RUN != mode ) {
+        if ( INIT == mode ) {
+            Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+                CALL_INFO, 1,
+                "ERROR: Trying to send or recv from link during initialization.  Send and Recv cannot be called before "
+                "setup.\n");
+        }
+        else if ( COMPLETE == mode ) {
+            Simulation_impl::getSimulation()->getSimulationOutput().fatal(
+                CALL_INFO, 1, "ERROR: Trying to call send or recv during complete phase.");
+        }
+    }
+
+    // Reused across calls so sending a batch doesn't allocate
+    static thread_local std::vector<Activity*> batch;
+    batch.resize(count);
+
+    Cycle_t base = current_time + latency;
+    for ( size_t i = 0; i < count; ++i ) {
+        Event* event = events[i];
+        if ( event == nullptr ) { event = new NullEvent(); }
+        event->setDeliveryTime(base + (delays ? delays[i] * factor : 0));
+        event->setDeliveryInfo(tag, delivery_info);
+
+#if __SST_DEBUG_EVENT_TRACKING__
+        event->addSendComponent(comp, ctype, port);
+        event->addRecvComponent(pair_link->comp, pair_link->ctype, pair_link->port);
+#endif
+
+        if ( profile_tools ) profile_tools->eventSent(event);
+        batch[i] = event;
+    }
+    send_queue->insertBatch(batch.data(), count);
+}
+
 
 Event*
 Link::recv()
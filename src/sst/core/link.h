@@ -112,6 +112,35 @@ public:
      */
     inline void send(Event* event) { send_impl(0, event); }
 
+    /** Send a batch of events, each with its own additional delay
+     * specified with a TimeConverter.  Same as calling send(delays[i],
+     * tc, events[i]) for each event in order, but the checks are only
+     * done once and all the events are handed to the receiving queue
+     * at once.
+     * @param count Number of events to send
+     * @param events The events to send.  nullptr entries send a NullEvent
+     * @param delays Additional delay for each event, or nullptr for no
+     * additional delay
+     * @param tc Time converter to specify units for the additional delays
+     */
+    inline void sendBatch(size_t count, Event* const* events, const SimTime_t* delays, TimeConverter* tc)
+    {
+        sendBatch_impl(count, events, delays, tc->getFactor());
+    }
+
+    /** Send a batch of events, each with its own additional delay
+     * specified by the Link's default timebase.  Same as calling
+     * send(delays[i], events[i]) for each event in order.
+     * @param count Number of events to send
+     * @param events The events to send.  nullptr entries send a NullEvent
+     * @param delays Additional delay for each event, or nullptr for no
+     * additional delay
+     */
+    inline void sendBatch(size_t count, Event* const* events, const SimTime_t* delays = nullptr)
+    {
+        sendBatch_impl(count, events, delays, defaultTimeBase);
+    }
+
 
     /** Retrieve a pending event from the Link. For links which do not
      * have a set event handler, they can be polled with this function.
@@ -204,6 +233,14 @@ protected:
      */
     void send_impl(SimTime_t delay, Event* event);
 
+    /** Send a batch of events.
+     * @param count - number of events to send
+     * @param events - the Events to send
+     * @param delays - additional delays in units of factor, or nullptr
+     * @param factor - number of core time units per unit of delay
+     */
+    void sendBatch_impl(size_t count, Event* const* events, const SimTime_t* delays, SimTime_t factor);
+
     // Since Links are found in pairs, I will keep all the information
     // needed for me to send and deliver an event to the other side of
     // the link.  That means, that I mostly keep my pair's
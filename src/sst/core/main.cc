@@ -28,6 +28,7 @@ REENABLE_WARNING
 #include "sst/core/configGraph.h"
 #include "sst/core/cputimer.h"
 #include "sst/core/factory.h"
+#include "sst/core/impl/partitioners/hierarchicalpart.h"
 #include "sst/core/iouse.h"
 #include "sst/core/link.h"
 #include "sst/core/memuse.h"
@@ -42,6 +43,7 @@ REENABLE_WARNING
 #include "sst/core/timeLord.h"
 #include "sst/core/timeVortex.h"
 
+#include <algorithm>
 #include <cinttypes>
 #include <exception>
 #include <fstream>
@@ -58,6 +60,10 @@ REENABLE_WARNING
 #include "sst/core/configGraphOutput.h"
 #include "sst/core/eli/elementinfo.h"
 
+#include "nlohmann/json.hpp"
+
+#include <map>
+
 using namespace SST::Core;
 using namespace SST::Partition;
 using namespace std;
@@ -193,6 +199,144 @@ dump_partition(Config& cfg, ConfigGraph* graph, const RankInfo& size)
     }
 }
 
+static std::string
+format_latency(SimTime_t cycles)
+{
+    return (Simulation_impl::getTimeLord()->getTimeBase() * cycles).toStringBestSI();
+}
+
+// Number of syncs per simulated second with a sync interval of cycles
+static double
+syncs_per_second(SimTime_t cycles)
+{
+    if ( cycles == MAX_SIMTIME_T ) return 0;
+    return 1.0 / (Simulation_impl::getTimeLord()->getTimeBase() * cycles).getDoubleValue();
+}
+
+static void
+report_partition(Config& cfg, ConfigGraph* graph, const RankInfo& size)
+{
+    ///////////////////////////////////////////////////////////////////////
+    // If the user asks for a report on the quality of the partition
+    if ( cfg.partition_report_file() == "" ) return;
+
+    if ( cfg.parallel_load() ) {
+        g_output.output("WARNING: --output-partition-report is not supported with --parallel-load.\n");
+        return;
+    }
+
+    ConfigComponentMap_t& comps = graph->getComponentMap();
+    ConfigLinkMap_t&      links = graph->getLinkMap();
+
+    uint32_t            num_parts = size.rank * size.thread;
+    std::vector<size_t> part_comps(num_parts, 0);
+    std::vector<double> part_weight(num_parts, 0);
+    std::vector<size_t> part_cut(num_parts, 0);
+    for ( ConfigComponent* comp : comps ) {
+        uint32_t part = comp->rank.rank * size.thread + comp->rank.thread;
+        part_comps[part]++;
+        part_weight[part] += comp->weight;
+    }
+
+    // Count the cut links by latency, between ranks and between
+    // threads of the same rank
+    std::map<SimTime_t, std::pair<size_t, size_t>> cut_latencies;
+    size_t                                         rank_cut   = 0;
+    size_t                                         thread_cut = 0;
+    SimTime_t                                      min_part   = MAX_SIMTIME_T;
+    SimTime_t                                      min_thread = MAX_SIMTIME_T;
+    for ( ConfigLink* link : links ) {
+        RankInfo rank[2];
+        rank[0] = comps[COMPONENT_ID_MASK(link->component[0])]->rank;
+        rank[1] = comps[COMPONENT_ID_MASK(link->component[1])]->rank;
+        if ( rank[0] == rank[1] ) continue;
+
+        SimTime_t latency = link->getMinLatency();
+        for ( int i = 0; i < 2; i++ ) {
+            part_cut[rank[i].rank * size.thread + rank[i].thread]++;
+        }
+        if ( rank[0].rank != rank[1].rank ) {
+            rank_cut++;
+            cut_latencies[latency].first++;
+            if ( latency < min_part ) min_part = latency;
+        }
+        else {
+            thread_cut++;
+            cut_latencies[latency].second++;
+            if ( latency < min_thread ) min_thread = latency;
+        }
+    }
+
+    nlohmann::ordered_json report;
+    report["partitioner"] = cfg.partitioner();
+    report["ranks"]       = size.rank;
+    report["threads"]     = size.thread;
+    report["parts"]       = nlohmann::ordered_json::array();
+    for ( uint32_t i = 0; i < num_parts; i++ ) {
+        nlohmann::ordered_json part;
+        part["rank"]       = i / size.thread;
+        part["thread"]     = i % size.thread;
+        part["components"] = part_comps[i];
+        part["weight"]     = part_weight[i];
+        part["cut_links"]  = part_cut[i];
+        report["parts"].push_back(part);
+    }
+    report["links"]["total"]               = links.size();
+    report["links"]["cut_between_ranks"]   = rank_cut;
+    report["links"]["cut_between_threads"] = thread_cut;
+    report["cut_latencies"]                = nlohmann::ordered_json::array();
+    for ( auto& x : cut_latencies ) {
+        nlohmann::ordered_json entry;
+        entry["latency"]         = format_latency(x.first);
+        entry["between_ranks"]   = x.second.first;
+        entry["between_threads"] = x.second.second;
+        report["cut_latencies"].push_back(entry);
+    }
+    report["min_part"]                = min_part == MAX_SIMTIME_T ? "none" : format_latency(min_part);
+    report["min_thread_part"]         = min_thread == MAX_SIMTIME_T ? "none" : format_latency(min_thread);
+    report["rank_syncs_per_second"]   = syncs_per_second(min_part);
+    report["thread_syncs_per_second"] = syncs_per_second(min_thread);
+
+    ofstream report_file(cfg.partition_report_file().c_str());
+    if ( !report_file.is_open() ) {
+        g_output.fatal(
+            CALL_INFO, 1, "Unable to open partition report file %s\n", cfg.partition_report_file().c_str());
+    }
+    report_file << std::setw(2) << report << std::endl;
+    report_file.close();
+
+    // Human readable summary
+    double total_weight = 0;
+    for ( double w : part_weight ) {
+        total_weight += w;
+    }
+    double max_weight = *std::max_element(part_weight.begin(), part_weight.end());
+    g_output.output("# Partition report (written to %s):\n", cfg.partition_report_file().c_str());
+    g_output.output("#   Part        Components       Weight    Cut links\n");
+    for ( uint32_t i = 0; i < num_parts; i++ ) {
+        g_output.output(
+            "#   %5" PRIu32 ".%-5" PRIu32 " %10zu %12g %12zu\n", i / size.thread, i % size.thread, part_comps[i],
+            part_weight[i], part_cut[i]);
+    }
+    if ( total_weight > 0 ) {
+        g_output.output("#   Weight imbalance (max / mean): %g\n", max_weight * num_parts / total_weight);
+    }
+    g_output.output(
+        "#   Links: %zu total, %zu cut between ranks, %zu cut between threads\n", (size_t)links.size(), rank_cut,
+        thread_cut);
+    for ( auto& x : cut_latencies ) {
+        g_output.output(
+            "#   Cut links with latency %s: %zu between ranks, %zu between threads\n", format_latency(x.first).c_str(),
+            x.second.first, x.second.second);
+    }
+    g_output.output(
+        "#   Rank sync interval (min_part): %s, %g syncs per simulated second\n",
+        min_part == MAX_SIMTIME_T ? "none" : format_latency(min_part).c_str(), syncs_per_second(min_part));
+    g_output.output(
+        "#   Thread sync interval: %s, %g syncs per simulated second\n",
+        min_thread == MAX_SIMTIME_T ? "none" : format_latency(min_thread).c_str(), syncs_per_second(min_thread));
+}
+
 static void
 do_graph_wireup(ConfigGraph* graph, SST::Simulation_impl* sim, const RankInfo& myRank, SimTime_t min_part)
 {
@@ -284,6 +428,9 @@ typedef struct
     ConfigGraph* graph;
     SimTime_t    min_part;
 
+    // CPUs to bind the thread to, empty to leave it unbound
+    std::vector<uint32_t> cpus;
+
     // Time / stats information
     double      build_time;
     double      run_time;
@@ -311,6 +458,12 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
         setupSignals(tid);
     }
 
+    // Bind before creating anything so the thread's memory is placed
+    // in its NUMA domain
+    if ( !info.cpus.empty() && !SST::IMPL::Partition::SSTHierarchicalPartition::bindThread(info.cpus) ) {
+        g_output.output("WARNING: Unable to bind thread %" PRIu32 " to its NUMA domain.\n", tid);
+    }
+
     ////// Create Simulation Objects //////
     SST::Simulation_impl* sim = Simulation_impl::createSimulation(info.config, info.myRank, info.world_size);
 
@@ -433,6 +586,11 @@ start_simulation(uint32_t tid, SimThreadInfo_t& info, Core::ThreadSafe::Barrier&
         barrier.wait();
     }
 
+#ifdef USE_MEMPOOL
+    // Make sure events freed by this thread for other threads are
+    // accounted for in the mempool usage
+    Activity::flushRemoteFrees();
+#endif
     barrier.wait();
 
     info.simulated_time = sim->getFinalSimTime();
@@ -626,6 +784,11 @@ main(int argc, char* argv[])
         if ( graph->checkForStructuralErrors() ) {
             g_output.fatal(CALL_INFO, 1, "Structure errors found in the ConfigGraph.\n");
         }
+
+        // Weight the graph with the profile of an earlier run
+        if ( !cfg.partition_weights().empty() && !graph->readPartitionWeights(cfg.partition_weights()) ) {
+            g_output.fatal(CALL_INFO, 1, "Unable to read the files given to --partition-weights.\n");
+        }
     }
 
     // Delete the model generator
@@ -651,8 +814,15 @@ main(int argc, char* argv[])
         // but the same code path
         if ( world_size.rank == 1 && world_size.thread == 1 ) cfg.partitioner_ = "sst.single";
 
+        if ( myRank.rank == 0 && cfg.partition_lookahead() != "" && cfg.partitioner() != "sst.lookahead" ) {
+            g_output.output(
+                "WARNING: --partition-lookahead is only used by the sst.lookahead partitioner, not %s.\n",
+                cfg.partitioner().c_str());
+        }
+
         // Get the partitioner.  Built in partitioners are in the "sst" library.
         SSTPartitioner* partitioner = factory->CreatePartitioner(cfg.partitioner(), world_size, myRank, cfg.verbose());
+        partitioner->configure(cfg);
 
         try {
             if ( partitioner->requiresConfigGraph() ) { partitioner->performPartition(graph); }
@@ -697,6 +867,7 @@ main(int argc, char* argv[])
 
         // Output the partition information if user requests it
         dump_partition(cfg, graph, world_size);
+        report_partition(cfg, graph, world_size);
     }
 
     ////// End Partitioning //////
@@ -762,6 +933,11 @@ main(int argc, char* argv[])
             Comms::broadcast(Params::nextKeyID, 0);
             Comms::broadcast(Params::global_params, 0);
 
+            // The graph only carries indices into the string table
+            std::vector<std::string> config_strings = ConfigString::getTable();
+            Comms::broadcast(config_strings, 0);
+            if ( myRank.rank != 0 ) ConfigString::setTable(config_strings);
+
             std::set<uint32_t> my_ranks;
             std::set<uint32_t> your_ranks;
 
@@ -831,10 +1007,12 @@ main(int argc, char* argv[])
 
     Simulation_impl::factory    = factory;
     Simulation_impl::sim_output = g_output;
-    Simulation_impl::resizeBarriers(world_size.thread);
+    Simulation_impl::resizeBarriers(world_size.thread, cfg.barrier_mode() == "hybrid");
 #ifdef USE_MEMPOOL
     /* Estimate that we won't have more than 128 sizes of events */
     Activity::memPools.reserve(world_size.thread * 128);
+    Activity::memPoolReclaim   = cfg.mempool_reclaim();
+    Activity::memPoolHugePages = cfg.mempool_huge_pages();
 #endif
 
     std::vector<std::thread>     threads(world_size.thread);
@@ -848,6 +1026,31 @@ main(int argc, char* argv[])
         threadInfo[i].min_part      = min_part;
     }
 
+    if ( cfg.thread_numa_binding() ) {
+        // The partition was made with the NUMA layout of rank 0
+        uint32_t domains       = SST::IMPL::Partition::SSTHierarchicalPartition::countDomains(world_size.thread);
+        uint32_t rank0_domains = domains;
+#ifdef SST_CONFIG_HAVE_MPI
+        Comms::broadcast(rank0_domains, 0);
+#endif
+        if ( domains != rank0_domains ) {
+            g_output.output(
+                "WARNING: Rank %" PRIu32 " has %" PRIu32 " usable NUMA domains but the partition assumed the %" PRIu32
+                " of rank 0.\n",
+                myRank.rank, domains, rank0_domains);
+        }
+
+        std::vector<std::vector<uint32_t>> cpus;
+        if ( SST::IMPL::Partition::SSTHierarchicalPartition::getThreadCpus(world_size.thread, cpus) ) {
+            for ( uint32_t i = 0; i < world_size.thread; i++ ) {
+                threadInfo[i].cpus = cpus[i];
+            }
+        }
+        else {
+            g_output.output("WARNING: NUMA layout not available, --thread-numa-binding will be ignored.\n");
+        }
+    }
+
     double end_serial_build = sst_get_cpu_time();
 
     try {
@@ -899,6 +1102,9 @@ main(int argc, char* argv[])
     Activity::getMemPoolUsage(mempool_size, active_activities);
 #endif
 
+    uint64_t barrier_spins  = Core::ThreadSafe::Barrier::getSpinWaitCount(), global_barrier_spins = 0;
+    uint64_t barrier_sleeps = Core::ThreadSafe::Barrier::getSleepWaitCount(), global_barrier_sleeps = 0;
+
 #ifdef SST_CONFIG_HAVE_MPI
     uint64_t local_sync_data_size = threadInfo[0].sync_data_size;
 
@@ -912,6 +1118,8 @@ main(int argc, char* argv[])
     MPI_Allreduce(&mempool_size, &max_mempool_size, 1, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD);
     MPI_Allreduce(&mempool_size, &global_mempool_size, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
     MPI_Allreduce(&active_activities, &global_active_activities, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&barrier_spins, &global_barrier_spins, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(&barrier_sleeps, &global_barrier_sleeps, 1, MPI_UINT64_T, MPI_SUM, MPI_COMM_WORLD);
 #else
     max_build_time            = build_time;
     max_run_time              = run_time;
@@ -923,6 +1131,8 @@ main(int argc, char* argv[])
     max_mempool_size          = mempool_size;
     global_mempool_size       = mempool_size;
     global_active_activities  = active_activities;
+    global_barrier_spins      = barrier_spins;
+    global_barrier_sleeps     = barrier_sleeps;
 #endif
 
     const uint64_t local_max_rss     = maxLocalMemSize();
@@ -975,6 +1185,10 @@ main(int argc, char* argv[])
         g_output.output("Max TimeVortex depth:            %" PRIu64 " entries\n", global_max_tv_depth);
         g_output.output("Max Sync data size:              %s\n", global_max_sync_data_size_ua.toStringBestSI().c_str());
         g_output.output("Global Sync data size:           %s\n", global_sync_data_size_ua.toStringBestSI().c_str());
+        if ( cfg.barrier_mode() == "hybrid" ) {
+            g_output.output("Barrier waits done spinning:     %" PRIu64 " waits\n", global_barrier_spins);
+            g_output.output("Barrier waits done sleeping:     %" PRIu64 " waits\n", global_barrier_sleeps);
+        }
         g_output.output("------------------------------------------------------------\n");
         g_output.output("\n");
         g_output.output("\n");
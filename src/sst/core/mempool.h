@@ -28,6 +28,12 @@ namespace Core {
 
 /**
  * Simple Memory Pool class
+ *
+ * A pool is owned by the thread that creates it, and only that thread
+ * may allocate from it.  Elements can be freed from any thread:
+ * elements freed by the owner go on an unlocked free list, elements
+ * freed by any other thread go on a locked list that the owner
+ * reclaims in one step once its own list runs dry.
  */
 class MemPool
 {
@@ -44,6 +50,12 @@ class MemPool
             list.push_back(ptr);
         }
 
+        inline void insert(void* const* ptrs, size_t count)
+        {
+            std::lock_guard<LOCK_t> lock(mtx);
+            list.insert(list.end(), ptrs, ptrs + count);
+        }
+
         inline void* try_remove()
         {
             std::lock_guard<LOCK_t> lock(mtx);
@@ -53,6 +65,13 @@ class MemPool
             return p;
         }
 
+        /** Move the whole list into dest, which must be empty */
+        inline void remove_all(std::vector<void*>& dest)
+        {
+            std::lock_guard<LOCK_t> lock(mtx);
+            dest.swap(list);
+        }
+
         size_t size() const { return list.size(); }
     };
 
@@ -60,35 +79,70 @@ public:
     /** Create a new Memory Pool.
      * @param elementSize - Size of each Element
      * @param initialSize - Size of the memory pool (in bytes)
+     * @param reclaim - Return arenas to the OS once all their elements
+     *     are free.  Only supported if initialSize is a power of two.
+     * @param hugePages - Ask for arenas to be backed by transparent huge
+     *     pages.  Only supported if initialSize is a multiple of the
+     *     huge page size.
      */
-    MemPool(size_t elementSize, size_t initialSize = (2 << 20)) :
+    MemPool(size_t elementSize, size_t initialSize = (2 << 20), bool reclaim = false, bool hugePages = false) :
         numAlloc(0),
         numFree(0),
+        numRemoteFree(0),
         elemSize(elementSize),
         arenaSize(initialSize),
-        allocating(false)
+        reclaim(reclaim && (initialSize & (initialSize - 1)) == 0),
+        hugePages(hugePages && (initialSize % hugePageSize) == 0),
+        owner(std::this_thread::get_id()),
+        bumpArena(nullptr),
+        bumpNext(nullptr),
+        bumpEnd(nullptr),
+        emptyArenas(0),
+        maxArenas(0),
+        numReclaimed(0)
     {
+        // With reclamation, the end of each arena holds the count of
+        // elements handed out from it
+        elemsPerArena = (arenaSize - (this->reclaim ? sizeof(size_t) : 0)) / elemSize;
         allocPool();
     }
 
     ~MemPool()
     {
         for ( std::list<uint8_t*>::iterator i = arenas.begin(); i != arenas.end(); ++i ) {
-            ::free(*i);
+            munmap(*i, arenaSize);
         }
     }
 
-    /** Allocate a new element from the memory pool */
+    /** Allocate a new element from the memory pool.  Must only be
+     * called by the thread that owns the pool. */
     inline void* malloc()
     {
-        void* ret = freeList.try_remove();
-        while ( !ret ) {
-            bool ok = allocPool();
-            if ( !ok ) return nullptr;
-            sst_pause();
-            ret = freeList.try_remove();
+        void* ret;
+        if ( localFreeList.empty() ) {
+            remoteFreeList.remove_all(localFreeList);
+            if ( reclaim ) {
+                for ( auto ptr : localFreeList )
+                    releaseElement(ptr);
+                if ( canReclaim() ) reclaimArenas();
+            }
+        }
+        if ( !localFreeList.empty() ) {
+            ret = localFreeList.back();
+            localFreeList.pop_back();
         }
-        ++numAlloc;
+        else {
+            // Carve the next element off the newest arena.  Arenas
+            // are never touched until an element is handed out, so
+            // pages that are never needed are never made resident.
+            if ( bumpNext == bumpEnd && !allocPool() ) return nullptr;
+            ret = bumpNext;
+            bumpNext += elemSize;
+        }
+        if ( reclaim && getLiveCount(ret)++ == 0 && getArena(ret) != bumpArena ) emptyArenas--;
+        // Only the owner updates these, so no need for an atomic
+        // increment
+        numAlloc.store(numAlloc.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
         return ret;
     }
 
@@ -96,13 +150,38 @@ public:
     inline void free(void* ptr)
     {
         // TODO:  Make sure this is in one of our arenas
-        freeList.insert(ptr);
+        if ( isOwner() )
+            freeLocal(ptr);
+        else
+            freeRemote(&ptr, 1);
+    }
+
+    /** Return an element to the memory pool.  Must only be called by
+     * the thread that owns the pool. */
+    inline void freeLocal(void* ptr)
+    {
+        localFreeList.push_back(ptr);
         // #ifdef __SST_DEBUG_EVENT_TRACKING__
         //         *((uint64_t*)ptr) = 0xFFFFFFFFFFFFFFFF;
         // #endif
-        ++numFree;
+        numFree.store(numFree.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        if ( reclaim ) {
+            releaseElement(ptr);
+            if ( canReclaim() ) reclaimArenas();
+        }
+    }
+
+    /** Return a batch of elements to the memory pool from a thread
+     * other than the owner.  Takes the lock once for the whole batch. */
+    inline void freeRemote(void* const* ptrs, size_t count)
+    {
+        remoteFreeList.insert(ptrs, count);
+        numRemoteFree.fetch_add(count, std::memory_order_relaxed);
     }
 
+    /** Returns true if the calling thread owns the pool */
+    inline bool isOwner() const { return std::this_thread::get_id() == owner; }
+
     /**
        Approximates the current memory usage of the mempool. Some
        overheads are not taken into account.
@@ -110,54 +189,139 @@ public:
     uint64_t getBytesMemUsed()
     {
         uint64_t bytes_in_arenas    = arenas.size() * arenaSize;
-        uint64_t bytes_in_free_list = freeList.size() * sizeof(void*);
+        uint64_t bytes_in_free_list = (localFreeList.size() + remoteFreeList.size()) * sizeof(void*);
         return bytes_in_arenas + bytes_in_free_list;
     }
 
-    uint64_t getUndeletedEntries() { return numAlloc - numFree; }
+    uint64_t getUndeletedEntries() { return numAlloc - numFree - numRemoteFree; }
+
+    /** Largest number of bytes the pool has had in arenas at once */
+    uint64_t getHighWaterBytes() const { return maxArenas * arenaSize; }
+
+    /** Bytes in arenas that are currently handed out */
+    uint64_t getBytesInUse() { return getUndeletedEntries() * elemSize; }
+
+    /** Bytes in arenas that have been returned to the OS */
+    uint64_t getBytesReclaimed() const { return numReclaimed * arenaSize; }
 
     /** Counter:  Number of times elements have been allocated */
     std::atomic<uint64_t> numAlloc;
-    /** Counter:  Number times elements have been freed */
+    /** Counter:  Number times elements have been freed by the owning thread */
     std::atomic<uint64_t> numFree;
+    /** Counter:  Number times elements have been freed by other threads */
+    std::atomic<uint64_t> numRemoteFree;
 
     size_t getArenaSize() const { return arenaSize; }
     size_t getElementSize() const { return elemSize; }
+    size_t getElementsPerArena() const { return elemsPerArena; }
 
     const std::list<uint8_t*>& getArenas() { return arenas; }
 
 private:
+    static const size_t hugePageSize = 2 << 20;
+
     bool allocPool()
     {
-        /* If already in progress, return */
-        if ( allocating.exchange(1, std::memory_order_acquire) ) { return true; }
+        uint8_t* newPool = mapArena();
+        if ( nullptr == newPool ) { return false; }
+        // Fresh anonymous mappings are zero filled, so elements that
+        // have never been handed out have a null header and are
+        // skipped when looking for undeleted activities
+        arenas.push_back(newPool);
+        if ( arenas.size() > maxArenas ) maxArenas = arenas.size();
+        bumpArena = newPool;
+        bumpNext  = newPool;
+        bumpEnd   = newPool + elemsPerArena * elemSize;
+        return true;
+    }
+
+    uint8_t* mapArena()
+    {
+        // Reclamation finds the arena of an element by masking its
+        // address, and huge pages need huge page alignment
+        size_t align = 0;
+        if ( hugePages ) align = hugePageSize;
+        if ( reclaim && arenaSize > align ) align = arenaSize;
+
+        size_t   mapSize = arenaSize + align;
+        uint8_t* ptr     = (uint8_t*)mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
+        if ( MAP_FAILED == (void*)ptr ) return nullptr;
+        if ( align == 0 ) return ptr;
 
-        uint8_t* newPool = (uint8_t*)mmap(nullptr, arenaSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANON, -1, 0);
-        if ( MAP_FAILED == newPool ) {
-            allocating.store(0, std::memory_order_release);
-            return false;
+        // Trim the extra off both ends to get an aligned arena
+        uint8_t* aligned = (uint8_t*)(((uintptr_t)ptr + align - 1) & ~(uintptr_t)(align - 1));
+        if ( aligned != ptr ) munmap(ptr, aligned - ptr);
+        size_t tail = (ptr + mapSize) - (aligned + arenaSize);
+        if ( tail != 0 ) munmap(aligned + arenaSize, tail);
+#ifdef MADV_HUGEPAGE
+        if ( hugePages ) madvise(aligned, arenaSize, MADV_HUGEPAGE);
+#endif
+        return aligned;
+    }
+
+    inline uint8_t* getArena(void* ptr) const { return (uint8_t*)((uintptr_t)ptr & ~(uintptr_t)(arenaSize - 1)); }
+
+    inline size_t& getLiveCount(void* ptr) const { return *(size_t*)(getArena(ptr) + arenaSize - sizeof(size_t)); }
+
+    /** Update the live count for an element that is back on the local
+     * free list */
+    inline void releaseElement(void* ptr)
+    {
+        if ( --getLiveCount(ptr) == 0 && getArena(ptr) != bumpArena ) emptyArenas++;
+    }
+
+    /** Only worth scanning the free list if it would shrink by at
+     * least a quarter, which keeps the cost amortized O(1) per free */
+    inline bool canReclaim() const { return emptyArenas > 0 && emptyArenas * elemsPerArena * 4 >= localFreeList.size(); }
+
+    /** Unmap every arena that has no elements handed out.  The arena
+     * currently being carved up is never reclaimed. */
+    void reclaimArenas()
+    {
+        size_t out = 0;
+        for ( auto ptr : localFreeList ) {
+            uint8_t* arena = getArena(ptr);
+            if ( arena != bumpArena && getLiveCount(ptr) == 0 ) continue;
+            localFreeList[out++] = ptr;
         }
-        std::memset(newPool, 0xFF, arenaSize);
-        arenas.push_back(newPool);
-        size_t nelem = arenaSize / elemSize;
-        for ( size_t i = 0; i < nelem; i++ ) {
-            uint64_t* ptr = (uint64_t*)(newPool + (elemSize * i));
-            // #ifdef __SST_DEBUG_EVENT_TRACKING__
-            //             *ptr = 0xFFFFFFFFFFFFFFFF;
-            // #endif
-            freeList.insert(ptr);
-            // freeList.push_back(newPool + (elemSize*i));
+        localFreeList.resize(out);
+
+        for ( auto it = arenas.begin(); it != arenas.end(); ) {
+            uint8_t* arena = *it;
+            if ( arena != bumpArena && getLiveCount(arena) == 0 ) {
+                munmap(arena, arenaSize);
+                it = arenas.erase(it);
+                numReclaimed++;
+            }
+            else {
+                ++it;
+            }
         }
-        allocating.store(0, std::memory_order_release);
-        return true;
+        emptyArenas = 0;
     }
 
     size_t elemSize;
     size_t arenaSize;
+    size_t elemsPerArena;
+    bool   reclaim;
+    bool   hugePages;
 
-    std::atomic<unsigned int>      allocating;
-    FreeList<ThreadSafe::Spinlock> freeList;
+    std::thread::id                owner;
+    std::vector<void*>             localFreeList;
+    FreeList<ThreadSafe::Spinlock> remoteFreeList;
     std::list<uint8_t*>            arenas;
+
+    // Part of the newest arena that has not been handed out yet
+    uint8_t* bumpArena;
+    uint8_t* bumpNext;
+    uint8_t* bumpEnd;
+
+    // Number of arenas (other than bumpArena) with nothing handed out
+    size_t emptyArenas;
+
+    // Stats
+    size_t maxArenas;
+    size_t numReclaimed;
 };
 
 } // namespace Core
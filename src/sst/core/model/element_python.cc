@@ -64,9 +64,18 @@ abortOnPyErr(uint32_t line, const char* file, const char* func, uint32_t exit_co
     // Need to format the backtrace
     PyTracebackObject* ptb = (PyTracebackObject*)tb;
     while ( ptb != nullptr ) {
+#ifdef SST_CONFIG_HAVE_PYTHON3
+#if PY_VERSION_HEX >= 0x030900B1
+        // Frames are opaque starting in 3.11, so use the accessor
+        // when it is available.  It returns a new reference.
+        PyCodeObject* code = PyFrame_GetCode(ptb->tb_frame);
+#else
+        PyCodeObject* code = ptb->tb_frame->f_code;
+#endif
+#endif
         // Filename
 #ifdef SST_CONFIG_HAVE_PYTHON3
-        stream << "File \"" << PyUnicode_AsUTF8(ptb->tb_frame->f_code->co_filename) << "\", ";
+        stream << "File \"" << PyUnicode_AsUTF8(code->co_filename) << "\", ";
 #else
         stream << "File \"" << PyString_AsString(ptb->tb_frame->f_code->co_filename) << "\", ";
 #endif
@@ -74,7 +83,10 @@ abortOnPyErr(uint32_t line, const char* file, const char* func, uint32_t exit_co
         stream << "line " << ptb->tb_lineno << ", ";
         // Module name
 #ifdef SST_CONFIG_HAVE_PYTHON3
-        stream << PyUnicode_AsUTF8(ptb->tb_frame->f_code->co_name) << "\n";
+        stream << PyUnicode_AsUTF8(code->co_name) << "\n";
+#if PY_VERSION_HEX >= 0x030900B1
+        Py_DECREF(code);
+#endif
 #else
         stream << PyString_AsString(ptb->tb_frame->f_code->co_name) << "\n";
 #endif
@@ -15,49 +15,89 @@
 
 namespace SST {
 
-PollingLinkQueue::PollingLinkQueue() : ActivityQueue() {}
+PollingLinkQueue::PollingLinkQueue() : ActivityQueue(), data(16, nullptr), mask(15), head(0), count(0) {}
 PollingLinkQueue::~PollingLinkQueue()
 {
     // Need to delete any events left in the queue
-    for ( auto it = data.begin(); it != data.end(); ++it ) {
-        delete *it;
+    for ( size_t i = 0; i < count; ++i ) {
+        delete at(i);
     }
-    data.clear();
 }
 
 bool
 PollingLinkQueue::empty()
 {
-    return data.empty();
+    return count == 0;
 }
 
 int
 PollingLinkQueue::size()
 {
-    return data.size();
+    return count;
 }
 
 void
 PollingLinkQueue::insert(Activity* activity)
 {
-    data.insert(activity);
+    if ( UNLIKELY(count == data.size()) ) grow();
+    if ( LIKELY(count == 0 || activity->getDeliveryTime() >= at(count - 1)->getDeliveryTime()) ) {
+        at(count++) = activity;
+        return;
+    }
+    insertOrdered(activity);
 }
 
 Activity*
 PollingLinkQueue::pop()
 {
-    if ( data.size() == 0 ) return nullptr;
-    auto      it      = data.begin();
-    Activity* ret_val = (*it);
-    data.erase(it);
+    if ( count == 0 ) return nullptr;
+    Activity* ret_val = data[head];
+    head              = (head + 1) & mask;
+    count--;
     return ret_val;
 }
 
 Activity*
 PollingLinkQueue::front()
 {
-    if ( data.size() == 0 ) return nullptr;
-    return *data.begin();
+    if ( count == 0 ) return nullptr;
+    return data[head];
+}
+
+void
+PollingLinkQueue::insertOrdered(Activity* activity)
+{
+    // Find the first event with a later delivery time, so that the
+    // new event goes after any events with the same time
+    SimTime_t time  = activity->getDeliveryTime();
+    size_t    first = 0;
+    size_t    last  = count;
+    while ( first < last ) {
+        size_t mid = first + (last - first) / 2;
+        if ( at(mid)->getDeliveryTime() <= time )
+            first = mid + 1;
+        else
+            last = mid;
+    }
+
+    // Shift everything after it back one slot
+    for ( size_t i = count; i > first; --i ) {
+        at(i) = at(i - 1);
+    }
+    at(first) = activity;
+    count++;
+}
+
+void
+PollingLinkQueue::grow()
+{
+    std::vector<Activity*> new_data(data.size() * 2, nullptr);
+    for ( size_t i = 0; i < count; ++i ) {
+        new_data[i] = at(i);
+    }
+    data.swap(new_data);
+    mask = data.size() - 1;
+    head = 0;
 }
 
 } // namespace SST
@@ -14,12 +14,18 @@
 
 #include "sst/core/activityQueue.h"
 
-#include <set>
+#include <vector>
 
 namespace SST {
 
 /**
  * A link queue which is used for polling only.
+ *
+ * Events are kept in delivery time order (events with the same time
+ * in the order they were inserted) in a ring buffer.  Links with a
+ * fixed latency always deliver in non-decreasing time order, so
+ * insert is almost always an append to the back; events that arrive
+ * out of order are placed with a binary search and a shift.
  */
 class PollingLinkQueue : public ActivityQueue
 {
@@ -34,7 +40,20 @@ public:
     Activity* front() override;
 
 private:
-    std::multiset<Activity*, Activity::less<true, false, false>> data;
+    /** Activity at position index, counted from the front */
+    inline Activity*& at(size_t index) { return data[(head + index) & mask]; }
+
+    /** Place an activity that sorts before the back of the queue */
+    void insertOrdered(Activity* activity);
+
+    /** Double the size of the ring buffer */
+    void grow();
+
+    std::vector<Activity*> data;
+    // data.size() - 1.  The size of data is always a power of 2.
+    size_t                 mask;
+    size_t                 head;
+    size_t                 count;
 };
 
 } // namespace SST
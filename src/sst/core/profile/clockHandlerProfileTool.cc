@@ -165,5 +165,29 @@ public:
 };
 
 
+ClockHandlerProfileToolPartition::ClockHandlerProfileToolPartition(
+    ProfileToolId_t id, const std::string& name, Params& params) :
+    ClockHandlerProfileTool(id, name, params)
+{}
+
+uintptr_t
+ClockHandlerProfileToolPartition::registerHandler(const HandlerMetaData& mdata)
+{
+    // Charge the time to the top level component, which is what gets
+    // partitioned
+    const ClockHandlerMetaData& data = dynamic_cast<const ClockHandlerMetaData&>(mdata);
+    return reinterpret_cast<uintptr_t>(&times_[COMPONENT_ID_MASK(data.comp_id)]);
+}
+
+void
+ClockHandlerProfileToolPartition::outputData(FILE* fp)
+{
+    fprintf(fp, "%s (id = %" PRIu64 ")\n", name.c_str(), my_id);
+    fprintf(fp, "# partition.component <id> <handler time (s)>\n");
+    for ( auto& x : times_ ) {
+        fprintf(fp, "partition.component %" PRIu64 " %.9lf\n", x.first, ((double)x.second) / 1000000000.0);
+    }
+}
+
 } // namespace Profile
 } // namespace SST
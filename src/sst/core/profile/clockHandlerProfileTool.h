@@ -115,6 +115,45 @@ private:
     std::map<std::string, clock_data_t> times_;
 };
 
+/**
+   Profile tool that times the clock handlers of each component and
+   writes the results in the form read by --partition-weights, so that
+   a later run can be partitioned by the measured cost of the
+   components
+ */
+class ClockHandlerProfileToolPartition : public ClockHandlerProfileTool
+{
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        ClockHandlerProfileToolPartition,
+        SST::Profile::ClockHandlerProfileTool,
+        "sst",
+        "profile.handler.clock.partition",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will time handlers by component for use with --partition-weights"
+    )
+
+    ClockHandlerProfileToolPartition(ProfileToolId_t id, const std::string& name, Params& params);
+
+    virtual ~ClockHandlerProfileToolPartition() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { start_time_ = std::chrono::steady_clock::now(); }
+
+    void handlerEnd(uintptr_t key) override
+    {
+        auto total_time = std::chrono::steady_clock::now() - start_time_;
+        *reinterpret_cast<uint64_t*>(key) += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+    }
+
+    void outputData(FILE* fp) override;
+
+private:
+    std::chrono::steady_clock::time_point start_time_;
+    std::map<ComponentId_t, uint64_t>     times_;
+};
+
 } // namespace Profile
 } // namespace SST
 
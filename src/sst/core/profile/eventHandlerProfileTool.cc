@@ -191,5 +191,45 @@ public:
 };
 
 
+EventHandlerProfileToolPartition::EventHandlerProfileToolPartition(
+    ProfileToolId_t id, const std::string& name, Params& params) :
+    EventHandlerProfileTool(id, name, params)
+{
+    // Only the receive handlers are timed
+    profile_sends_    = false;
+    profile_receives_ = true;
+}
+
+uintptr_t
+EventHandlerProfileToolPartition::registerHandler(const HandlerMetaData& mdata)
+{
+    const EventHandlerMetaData& data = dynamic_cast<const EventHandlerMetaData&>(mdata);
+    return reinterpret_cast<uintptr_t>(&ports_[std::make_pair(data.comp_id, data.port_name)]);
+}
+
+void
+EventHandlerProfileToolPartition::outputData(FILE* fp)
+{
+    // The time is charged to the top level component, which is what
+    // gets partitioned, and the counts to the (sub)component and port
+    // the link is connected to
+    std::map<ComponentId_t, uint64_t> comp_time;
+    for ( auto& x : ports_ ) {
+        comp_time[COMPONENT_ID_MASK(x.first.first)] += x.second.recv_time;
+    }
+
+    fprintf(fp, "%s (id = %" PRIu64 ")\n", name.c_str(), my_id);
+    fprintf(fp, "# partition.component <id> <handler time (s)>\n");
+    for ( auto& x : comp_time ) {
+        fprintf(fp, "partition.component %" PRIu64 " %.9lf\n", x.first, ((double)x.second) / 1000000000.0);
+    }
+    fprintf(fp, "# partition.port <id> <port> <recv count>\n");
+    for ( auto& x : ports_ ) {
+        fprintf(
+            fp, "partition.port %" PRIu64 " %s %" PRIu64 "\n", x.first.first, x.first.second.c_str(),
+            x.second.recv_count);
+    }
+}
+
 } // namespace Profile
 } // namespace SST
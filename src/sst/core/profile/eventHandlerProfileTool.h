@@ -20,6 +20,7 @@
 
 #include <chrono>
 #include <map>
+#include <utility>
 
 namespace SST {
 
@@ -139,6 +140,55 @@ private:
     std::map<std::string, event_data_t> times_;
 };
 
+/**
+   Profile tool that times the receive handlers of each port of each
+   component and writes the results in the form read by
+   --partition-weights, so that a later run can be partitioned by the
+   measured cost of the components and traffic on the links
+ */
+class EventHandlerProfileToolPartition : public EventHandlerProfileTool
+{
+    struct port_data_t
+    {
+        uint64_t recv_time;
+        uint64_t recv_count;
+
+        port_data_t() : recv_time(0), recv_count(0) {}
+    };
+
+public:
+    SST_ELI_REGISTER_PROFILETOOL(
+        EventHandlerProfileToolPartition,
+        SST::Profile::EventHandlerProfileTool,
+        "sst",
+        "profile.handler.event.partition",
+        SST_ELI_ELEMENT_VERSION(0, 1, 0),
+        "Profiler that will time handlers by component and port for use with --partition-weights"
+    )
+
+    EventHandlerProfileToolPartition(ProfileToolId_t id, const std::string& name, Params& params);
+
+    virtual ~EventHandlerProfileToolPartition() {}
+
+    uintptr_t registerHandler(const HandlerMetaData& mdata) override;
+
+    void handlerStart(uintptr_t UNUSED(key)) override { start_time_ = std::chrono::steady_clock::now(); }
+
+    void handlerEnd(uintptr_t key) override
+    {
+        auto         total_time = std::chrono::steady_clock::now() - start_time_;
+        port_data_t* entry      = reinterpret_cast<port_data_t*>(key);
+        entry->recv_time += std::chrono::duration_cast<std::chrono::nanoseconds>(total_time).count();
+        entry->recv_count++;
+    }
+
+    void outputData(FILE* fp) override;
+
+private:
+    std::chrono::steady_clock::time_point                        start_time_;
+    std::map<std::pair<ComponentId_t, std::string>, port_data_t> ports_;
+};
+
 } // namespace Profile
 } // namespace SST
 
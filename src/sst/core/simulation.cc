@@ -209,8 +209,65 @@ Simulation_impl::Simulation_impl(Config* cfg, RankInfo my_rank, RankInfo num_ran
     Params p;
     // params get passed twice - both the params and a ctor argument
     direct_interthread = cfg->interthread_links();
+    rank_sync_overlap  = cfg->rank_sync_overlap();
+    rank_sync_neighbor = cfg->rank_sync_neighbor();
+    rank_sync_shmem    = cfg->rank_sync_shmem();
+    // Events on interthread links don't go through the ThreadSync, so
+    // it can't tell when it is safe to move ahead of its neighbors
+    thread_sync_neighbor = cfg->thread_sync_neighbor();
+    hybrid_barriers      = cfg->barrier_mode() == "hybrid";
+    if ( thread_sync_neighbor && direct_interthread ) {
+        sim_output.fatal(CALL_INFO, 1, "ERROR: --thread-sync-neighbor can't be used with --interthread-links\n");
+    }
+    if ( rank_sync_neighbor + rank_sync_overlap + rank_sync_shmem > 1 ) {
+        sim_output.fatal(
+            CALL_INFO, 1,
+            "ERROR: Only one of --rank-sync-overlap, --rank-sync-neighbor and --rank-sync-shmem can be used\n");
+    }
+    // The heartbeat does collectives at fixed simulated times, which
+    // ranks that aren't synced together reach at different points
+    if ( rank_sync_neighbor && num_ranks.rank > 1 && cfg->heartbeatPeriod() != "" ) {
+        sim_output.fatal(CALL_INFO, 1, "ERROR: --rank-sync-neighbor can't be used with --heartbeat-period\n");
+    }
+    // The TimeVortex can be given params: type(key=value,key=value,...)
     std::string timevortex_type(cfg->timeVortex());
-    if ( direct_interthread && num_ranks.thread > 1 ) timevortex_type = timevortex_type + ".ts";
+    size_t      param_start = timevortex_type.find("(");
+    if ( param_start != std::string::npos ) {
+        size_t param_end = timevortex_type.find(")", param_start);
+        if ( param_end == std::string::npos ) {
+            sim_output.fatal(
+                CALL_INFO, 1,
+                "ERROR: Invalid format for --timeVortex (%s), format should be type(key=value,key=value,...)\n",
+                timevortex_type.c_str());
+        }
+        std::vector<std::string> pairs;
+        SST::tokenize(pairs, timevortex_type.substr(param_start + 1, param_end - param_start - 1), ",", true);
+        for ( auto& x : pairs ) {
+            std::vector<std::string> kv;
+            SST::tokenize(kv, x, "=", true);
+            if ( kv.size() < 2 ) {
+                sim_output.fatal(
+                    CALL_INFO, 1, "ERROR: Invalid format for TimeVortex params (%s), format should be key=value\n",
+                    x.c_str());
+            }
+            p.insert(kv[0], kv[1]);
+        }
+        timevortex_type = timevortex_type.substr(0, param_start);
+        trim(timevortex_type);
+    }
+    if ( direct_interthread && num_ranks.thread > 1 ) {
+        if ( cfg->interthread_inbox() ) {
+            // Other threads insert through lock-free inboxes, so the
+            // wrapped TimeVortex doesn't need to be thread safe
+            p.insert("vortex", timevortex_type);
+            p.insert("num_threads", std::to_string(num_ranks.thread));
+            p.insert("thread", std::to_string(my_rank.thread));
+            timevortex_type = "sst.timevortex.inbox";
+        }
+        else {
+            timevortex_type = timevortex_type + ".ts";
+        }
+    }
     timeVortex = factory->Create<TimeVortex>(timevortex_type, p);
     if ( my_rank.thread == 0 ) { m_exit = new Exit(num_ranks.thread, num_ranks.rank == 1); }
 
@@ -676,14 +733,58 @@ Simulation_impl::run()
 
     run_phase_start_time = sst_get_cpu_time();
 
+    // Activities are pulled off the TimeVortex in batches that share
+    // a delivery time and priority, and the bookkeeping below is done
+    // once per batch
+    std::vector<Activity*>           batch;
+    Activity::less<true, true, true> activity_less;
+
     while ( LIKELY(!endSim) ) {
-        current_activity = timeVortex->pop();
-        currentSimCycle  = current_activity->getDeliveryTime();
-        currentPriority  = current_activity->getPriority();
-        current_activity->execute();
+        batch.clear();
+        timeVortex->popBatch(batch);
+        currentSimCycle    = batch.front()->getDeliveryTime();
+        int batch_priority = batch.front()->getPriority();
+        currentPriority    = batch_priority;
+
+        // Anything inserted while the batch executes that sorts ahead
+        // of the rest of the batch (e.g. from a zero latency link) has
+        // to run first.  Only the run loop pops from the TimeVortex,
+        // so a change in depth means there were inserts.
+        uint64_t depth = timeVortex->getCurrentDepth();
+        bool     check = false;
+        size_t   next  = 0;
+        while ( next < batch.size() && LIKELY(!endSim) ) {
+            current_activity = batch[next];
+            if ( UNLIKELY(check || depth != timeVortex->getCurrentDepth()) ) {
+                Activity* head = timeVortex->empty() ? nullptr : timeVortex->front();
+                if ( head != nullptr && activity_less(head, current_activity) ) {
+                    current_activity = timeVortex->pop();
+                    check            = true;
+                }
+                else {
+                    // Nothing left in the queue can come before the
+                    // rest of the batch unless it shares its time and
+                    // priority
+                    check = head != nullptr && head->getDeliveryTime() == currentSimCycle &&
+                            head->getPriority() == batch_priority;
+                    next++;
+                }
+                currentPriority = current_activity->getPriority();
+                depth           = timeVortex->getCurrentDepth();
+            }
+            else {
+                next++;
+            }
+            current_activity->execute();
+        }
+
+        // If the simulation was ended part way through the batch, put
+        // the rest back so they are cleaned up with the TimeVortex
+        for ( ; next < batch.size(); ++next )
+            timeVortex->insert(batch[next]);
 
 #if SST_PERIODIC_PRINT
-        periodicCounter++;
+        periodicCounter += batch.size();
 #endif
 
         if ( UNLIKELY(0 != lastRecvdSignal) ) {
@@ -702,6 +803,7 @@ Simulation_impl::run()
                 sim_output.output(
                     "# Simulated time:                  %s\n", getElapsedSimTime().toStringBestSI().c_str());
                 endSim = true;
+                syncManager->simulationEnded();
                 break;
             default:
                 break;
@@ -793,6 +895,7 @@ Simulation_impl::endSimulation(SimTime_t end)
 
     endSimCycle = end;
     endSim      = true;
+    syncManager->simulationEnded();
 
     exitBarrier.wait();
 }
@@ -1056,7 +1159,7 @@ wait_my_turn_end(Core::ThreadSafe::Barrier& barrier, int thread, int total_threa
 }
 
 void
-Simulation_impl::resizeBarriers(uint32_t nthr)
+Simulation_impl::resizeBarriers(uint32_t nthr, bool hybrid)
 {
     initBarrier.resize(nthr);
     completeBarrier.resize(nthr);
@@ -1064,6 +1167,13 @@ Simulation_impl::resizeBarriers(uint32_t nthr)
     runBarrier.resize(nthr);
     exitBarrier.resize(nthr);
     finishBarrier.resize(nthr);
+
+    initBarrier.setHybrid(hybrid);
+    completeBarrier.setHybrid(hybrid);
+    setupBarrier.setHybrid(hybrid);
+    runBarrier.setHybrid(hybrid);
+    exitBarrier.setHybrid(hybrid);
+    finishBarrier.setHybrid(hybrid);
 }
 
 
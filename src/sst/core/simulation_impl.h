@@ -326,7 +326,7 @@ public:
     /** Factory used to generate the simulation components */
     static Factory* factory;
 
-    static void                      resizeBarriers(uint32_t nthr);
+    static void                      resizeBarriers(uint32_t nthr, bool hybrid);
     static Core::ThreadSafe::Barrier initBarrier;
     static Core::ThreadSafe::Barrier completeBarrier;
     static Core::ThreadSafe::Barrier setupBarrier;
@@ -337,6 +337,11 @@ public:
 
     static std::map<LinkId_t, Link*> cross_thread_links;
     bool                             direct_interthread;
+    bool                             rank_sync_overlap;
+    bool                             rank_sync_neighbor;
+    bool                             rank_sync_shmem;
+    bool                             thread_sync_neighbor;
+    bool                             hybrid_barriers;
 
     Component* createComponent(ComponentId_t id, const std::string& name, Params& params);
 
@@ -0,0 +1,776 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Standalone micro-benchmarks for the TimeVortex implementations and
+ * the Activity memory pools.  Nothing here needs a Simulation object,
+ * so the numbers only reflect the data structures themselves.
+ *
+ * TimeVortex benchmarks use the classic hold model: the queue is
+ * filled to a fixed depth, then each operation pops the head and
+ * reinserts it at its delivery time plus a random increment drawn
+ * from the selected distribution.  With more than one thread, the
+ * thread safe (.ts) version of the TimeVortex is used, with one
+ * thread popping and the others inserting part of the activities back
+ * in, the same way it is used with interthread links.
+ *
+ * MemPool benchmarks allocate and free Activity sized objects in a
+ * number of patterns.  Each operation is one allocate/free pair.  The
+ * reclaim variant runs the same patterns with pools that return empty
+ * arenas to the OS.
+ */
+
+#include "sst_config.h"
+
+#include "sst/core/action.h"
+#include "sst/core/factory.h"
+#include "sst/core/params.h"
+#include "sst/core/rng/mersenne.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/timeVortex.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cinttypes>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <getopt.h>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+using namespace SST;
+
+namespace {
+
+/** Activity that is only ever queued, never executed */
+class BenchAction : public Action
+{
+public:
+    BenchAction() {}
+    void execute() override {}
+};
+
+/** Mean of the hold time increments, in core time units */
+const double mean_increment = 1000.0;
+
+enum class Workload { EXPONENTIAL, UNIFORM, BIMODAL, CLUSTERED };
+enum class Pattern { LIFO, FIFO, RANDOM, REMOTE };
+
+struct BenchConfig
+{
+    std::vector<std::string> vortices;
+    std::vector<std::string> workloads { "exponential", "uniform", "bimodal", "clustered" };
+    std::vector<std::string> patterns { "lifo", "fifo", "random", "remote" };
+    std::vector<uint64_t>    sizes { 100, 10000, 1000000 };
+    std::vector<int>         threads { 1 };
+    uint64_t                 ops         = 1000000;
+    uint64_t                 object_size = 64;
+    unsigned int             seed        = 1;
+    bool                     run_vortex  = true;
+    bool                     run_mempool = true;
+    bool                     reclaim     = false;
+    bool                     csv         = false;
+};
+
+/** Results of one benchmark run */
+struct Result
+{
+    double   ns_per_op;
+    // -1 if the counter is not available
+    double   cache_misses_per_op;
+    double   instructions_per_op;
+    uint64_t ops;
+};
+
+/**
+ * Hardware counters for the whole process, including threads started
+ * after the counters are opened.  Uses perf_event_open where it is
+ * available and permitted, otherwise reports nothing.
+ */
+class PerfCounters
+{
+public:
+    PerfCounters()
+    {
+        misses_fd       = open(PERF_COUNT_HW_CACHE_MISSES);
+        instructions_fd = open(PERF_COUNT_HW_INSTRUCTIONS);
+    }
+
+    ~PerfCounters()
+    {
+#ifdef __linux__
+        if ( misses_fd >= 0 ) close(misses_fd);
+        if ( instructions_fd >= 0 ) close(instructions_fd);
+#endif
+    }
+
+    void start()
+    {
+#ifdef __linux__
+        for ( int fd : { misses_fd, instructions_fd } ) {
+            if ( fd < 0 ) continue;
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    void stop()
+    {
+#ifdef __linux__
+        for ( int fd : { misses_fd, instructions_fd } ) {
+            if ( fd >= 0 ) ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+        }
+#endif
+    }
+
+    /** Counts are only complete once the counted threads are joined */
+    int64_t getCacheMisses() { return read(misses_fd); }
+    int64_t getInstructions() { return read(instructions_fd); }
+
+private:
+#ifndef __linux__
+    enum { PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_INSTRUCTIONS };
+#endif
+
+    static int open(uint64_t config)
+    {
+#ifdef __linux__
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.size           = sizeof(attr);
+        attr.config         = config;
+        attr.disabled       = 1;
+        attr.inherit        = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        return syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+#else
+        (void)config;
+        return -1;
+#endif
+    }
+
+    static int64_t read(int fd)
+    {
+#ifdef __linux__
+        uint64_t count;
+        if ( fd >= 0 && ::read(fd, &count, sizeof(count)) == sizeof(count) ) return count;
+#else
+        (void)fd;
+#endif
+        return -1;
+    }
+
+    int misses_fd;
+    int instructions_fd;
+};
+
+/**
+ * Runs body(thread) on the requested number of threads, timing only
+ * the part where all of them are running
+ */
+template <typename Body>
+Result
+runTimed(int num_threads, uint64_t ops, Body body)
+{
+    PerfCounters             counters;
+    std::atomic<int>         ready(0);
+    std::atomic<bool>        go(false);
+    std::vector<std::thread> threads;
+
+    for ( int i = 0; i < num_threads; ++i ) {
+        threads.emplace_back([&, i]() {
+            ready++;
+            while ( !go.load() )
+                std::this_thread::yield();
+            body(i);
+        });
+    }
+    while ( ready.load() != num_threads )
+        std::this_thread::yield();
+
+    counters.start();
+    auto start = std::chrono::steady_clock::now();
+    go.store(true);
+    for ( auto& t : threads )
+        t.join();
+    auto end = std::chrono::steady_clock::now();
+    counters.stop();
+
+    Result  result;
+    int64_t misses       = counters.getCacheMisses();
+    int64_t instructions = counters.getInstructions();
+    result.ops           = ops;
+    result.ns_per_op     = std::chrono::duration<double, std::nano>(end - start).count() / ops;
+    result.cache_misses_per_op = misses < 0 ? -1.0 : (double)misses / ops;
+    result.instructions_per_op = instructions < 0 ? -1.0 : (double)instructions / ops;
+    return result;
+}
+
+/** Draws hold time increments from one of the workload distributions */
+class Increment
+{
+public:
+    Increment(Workload workload, unsigned int seed) : workload(workload), rng(seed) {}
+
+    SimTime_t next()
+    {
+        double u = rng.nextUniform();
+        switch ( workload ) {
+        case Workload::EXPONENTIAL:
+            return (SimTime_t)(-mean_increment * std::log(1.0 - u));
+        case Workload::UNIFORM:
+            return (SimTime_t)(2.0 * mean_increment * u);
+        case Workload::BIMODAL:
+            // 90% short holds with mean 0.1, 10% long holds with mean
+            // 9.1, for an overall mean of 1
+            if ( rng.nextUniform() < 0.9 ) return (SimTime_t)(0.2 * mean_increment * u);
+            return (SimTime_t)(18.2 * mean_increment * u);
+        case Workload::CLUSTERED:
+            // Exponential, rounded up to whole multiples of the mean,
+            // so that many activities share a delivery time the way
+            // they do in clock driven models
+            return (SimTime_t)(std::ceil(-std::log(1.0 - u)) * mean_increment);
+        }
+        return 0;
+    }
+
+private:
+    Workload         workload;
+    RNG::MersenneRNG rng;
+};
+
+Result
+benchVortex(const std::string& type, Workload workload, uint64_t size, int num_threads, const BenchConfig& cfg)
+{
+    Params      params;
+    TimeVortex* tv = Factory::getFactory()->Create<TimeVortex>(type, params);
+
+    // Fill the queue to its steady state depth
+    Increment fill(workload, cfg.seed);
+    for ( uint64_t i = 0; i < size; ++i ) {
+        Activity* act = new BenchAction();
+        act->setDeliveryTime(fill.next());
+        tv->insert(act);
+    }
+
+    auto hold = [&](Increment& inc, uint64_t count) {
+        for ( uint64_t i = 0; i < count; ++i ) {
+            Activity* act = tv->pop();
+            act->setDeliveryTime(act->getDeliveryTime() + inc.next());
+            tv->insert(act);
+        }
+    };
+
+    // Warm up until the timestamp distribution in the queue has
+    // settled, which takes about one pass through the queue
+    hold(fill, std::min(size, cfg.ops));
+
+    if ( num_threads == 1 ) {
+        Result result = runTimed(1, cfg.ops, [&](int) {
+            Increment inc(workload, cfg.seed + 1);
+            hold(inc, cfg.ops);
+        });
+        delete tv;
+        return result;
+    }
+
+    // Only the owning thread ever pops from a TimeVortex, so thread 0
+    // runs the hold loop and hands every num_threads'th activity to
+    // one of the other threads, which inserts it back the way an
+    // interthread link would.  As with a real thread sync, time is
+    // split into windows one mean increment long, handed off
+    // activities come back no earlier than the end of the current
+    // window, and thread 0 waits for all of them to arrive before it
+    // pops anything past the window.
+    std::vector<Core::ThreadSafe::SPSCQueue<Activity*>*> queues;
+    for ( int i = 1; i < num_threads; ++i )
+        queues.push_back(new Core::ThreadSafe::SPSCQueue<Activity*>());
+    const SimTime_t       window = (SimTime_t)mean_increment;
+    std::atomic<uint64_t> inserted(0);
+    std::atomic<bool>     done(false);
+
+    Result result = runTimed(num_threads, cfg.ops, [&](int thread) {
+        Increment inc(workload, cfg.seed + thread + 1);
+        if ( thread == 0 ) {
+            SimTime_t window_end = 0;
+            uint64_t  handed     = 0;
+            uint64_t  i          = 0;
+            while ( i < cfg.ops ) {
+                if ( handed != inserted.load(std::memory_order_acquire) ) {
+                    Activity* head = tv->front();
+                    if ( head == nullptr || head->getDeliveryTime() >= window_end ) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                }
+                Activity* act = tv->pop();
+                if ( act->getDeliveryTime() >= window_end ) window_end = act->getDeliveryTime() + window;
+
+                int target = i++ % num_threads;
+                if ( target == 0 ) {
+                    act->setDeliveryTime(act->getDeliveryTime() + inc.next());
+                    tv->insert(act);
+                }
+                else {
+                    handed++;
+                    queues[target - 1]->insert(act);
+                }
+            }
+            done.store(true);
+        }
+        else {
+            auto&     queue = *queues[thread - 1];
+            Activity* act;
+            while ( true ) {
+                if ( queue.try_remove(act) ) {
+                    act->setDeliveryTime(act->getDeliveryTime() + inc.next() + window);
+                    tv->insert(act);
+                    inserted.fetch_add(1, std::memory_order_release);
+                }
+                else if ( done.load() && queue.empty() ) {
+                    break;
+                }
+                else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    });
+
+    for ( auto q : queues )
+        delete q;
+    delete tv;
+    return result;
+}
+
+/** Allocate and free through the same path Activities use */
+inline void*
+allocate(size_t size)
+{
+#ifdef USE_MEMPOOL
+    void* ptr = Activity::operator new(size);
+#else
+    void* ptr = ::operator new(size);
+#endif
+    // Touch the object like a constructor would
+    *(uint64_t*)ptr = size;
+    return ptr;
+}
+
+inline void
+deallocate(void* ptr)
+{
+#ifdef USE_MEMPOOL
+    Activity::operator delete(ptr);
+#else
+    ::operator delete(ptr);
+#endif
+}
+
+Result
+benchMemPool(Pattern pattern, uint64_t size, int num_threads, const BenchConfig& cfg)
+{
+    size_t   obj_size   = cfg.object_size;
+    uint64_t per_thread = cfg.ops / num_threads;
+
+    if ( pattern == Pattern::REMOTE ) {
+        // Threads are paired up, with the first of each pair
+        // allocating and the second freeing, so every free is to a
+        // pool owned by another thread.  Size is the number of
+        // objects allowed in flight per pair.
+        int                                                   pairs = std::max(num_threads / 2, 1);
+        std::vector<Core::ThreadSafe::SPSCQueue<void*>*>      queues;
+        std::vector<std::unique_ptr<std::atomic<uint64_t>>>   freed;
+        for ( int i = 0; i < pairs; ++i ) {
+            queues.push_back(new Core::ThreadSafe::SPSCQueue<void*>());
+            freed.emplace_back(new std::atomic<uint64_t>(0));
+        }
+        per_thread = cfg.ops / pairs;
+
+        Result result = runTimed(pairs * 2, per_thread * pairs, [&](int thread) {
+            auto&                 queue = *queues[thread / 2];
+            std::atomic<uint64_t>& done = *freed[thread / 2];
+            if ( thread % 2 == 0 ) {
+                for ( uint64_t i = 0; i < per_thread; ++i ) {
+                    while ( i - done.load(std::memory_order_acquire) >= size )
+                        std::this_thread::yield();
+                    queue.insert(allocate(obj_size));
+                }
+            }
+            else {
+                void*    ptr;
+                uint64_t count = 0;
+                while ( count < per_thread ) {
+                    if ( !queue.try_remove(ptr) ) {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    deallocate(ptr);
+                    done.store(++count, std::memory_order_release);
+                }
+#ifdef USE_MEMPOOL
+                Activity::flushRemoteFrees();
+#endif
+            }
+        });
+
+        for ( auto q : queues )
+            delete q;
+        return result;
+    }
+
+    return runTimed(num_threads, per_thread * num_threads, [&](int thread) {
+        std::vector<void*> live(size);
+        switch ( pattern ) {
+        case Pattern::LIFO:
+            // Allocate size objects, then free them newest first
+            for ( uint64_t done = 0; done < per_thread; ) {
+                uint64_t count = std::min<uint64_t>(size, per_thread - done);
+                for ( uint64_t i = 0; i < count; ++i )
+                    live[i] = allocate(obj_size);
+                for ( uint64_t i = count; i > 0; --i )
+                    deallocate(live[i - 1]);
+                done += count;
+            }
+            break;
+        case Pattern::FIFO:
+            // Keep size objects live, always freeing the oldest
+            for ( auto& ptr : live )
+                ptr = allocate(obj_size);
+            for ( uint64_t i = 0; i < per_thread; ++i ) {
+                size_t slot = i % size;
+                deallocate(live[slot]);
+                live[slot] = allocate(obj_size);
+            }
+            for ( auto ptr : live )
+                deallocate(ptr);
+            break;
+        case Pattern::RANDOM:
+        {
+            // Keep size objects live, freeing them in random order
+            RNG::MersenneRNG rng(cfg.seed + thread);
+            for ( auto& ptr : live )
+                ptr = allocate(obj_size);
+            for ( uint64_t i = 0; i < per_thread; ++i ) {
+                size_t slot = rng.generateNextUInt64() % size;
+                deallocate(live[slot]);
+                live[slot] = allocate(obj_size);
+            }
+            for ( auto ptr : live )
+                deallocate(ptr);
+            break;
+        }
+        case Pattern::REMOTE:
+            break;
+        }
+    });
+}
+
+std::vector<std::string>
+splitList(const char* arg)
+{
+    std::vector<std::string> ret;
+    std::string              str(arg);
+    size_t                   start = 0;
+    while ( start <= str.size() ) {
+        size_t end = str.find(',', start);
+        if ( end == std::string::npos ) end = str.size();
+        if ( end > start ) ret.push_back(str.substr(start, end - start));
+        start = end + 1;
+    }
+    return ret;
+}
+
+bool
+parseWorkload(const std::string& name, Workload& workload)
+{
+    if ( name == "exponential" )
+        workload = Workload::EXPONENTIAL;
+    else if ( name == "uniform" )
+        workload = Workload::UNIFORM;
+    else if ( name == "bimodal" )
+        workload = Workload::BIMODAL;
+    else if ( name == "clustered" )
+        workload = Workload::CLUSTERED;
+    else
+        return false;
+    return true;
+}
+
+bool
+parsePattern(const std::string& name, Pattern& pattern)
+{
+    if ( name == "lifo" )
+        pattern = Pattern::LIFO;
+    else if ( name == "fifo" )
+        pattern = Pattern::FIFO;
+    else if ( name == "random" )
+        pattern = Pattern::RANDOM;
+    else if ( name == "remote" )
+        pattern = Pattern::REMOTE;
+    else
+        return false;
+    return true;
+}
+
+void
+printUsage(const char* app)
+{
+    printf("Usage: %s [options]\n", app);
+    printf("  -h, --help               Print this message\n");
+    printf("      --suite=LIST         Benchmarks to run: vortex, mempool (default: both)\n");
+    printf("  -v, --vortex=LIST        TimeVortex types (default: every registered sst.timevortex.*)\n");
+    printf("  -w, --workload=LIST      Hold time distributions: exponential, uniform, bimodal, clustered\n");
+    printf("  -p, --pattern=LIST       MemPool patterns: lifo, fifo, random, remote\n");
+    printf("  -s, --sizes=LIST         Queue depths / live object counts (default: 100,10000,1000000)\n");
+    printf("  -t, --threads=LIST       Thread counts (default: 1).  The remote pattern uses pairs of threads and\n");
+    printf("                           skips odd counts\n");
+    printf("  -n, --ops=N              Operations per run, across all threads (default: 1000000)\n");
+    printf("      --object-size=BYTES  Size of the objects allocated by the MemPool benchmarks (default: 64)\n");
+    printf("      --seed=N             Random number seed (default: 1)\n");
+    printf("      --mempool-reclaim    Also run the MemPool benchmarks with pools that return empty arenas\n");
+    printf("                           to the OS\n");
+    printf("      --csv                Print results as comma separated values\n");
+    printf("\nLISTs are comma separated.  Cache misses and instructions are per operation and\n");
+    printf("are reported as n/a when hardware counters are not available.\n");
+}
+
+int
+parseCmdLine(int argc, char* argv[], BenchConfig& cfg)
+{
+    static const struct option longOpts[] = { { "help", no_argument, nullptr, 'h' },
+                                              { "suite", required_argument, nullptr, 0 },
+                                              { "vortex", required_argument, nullptr, 'v' },
+                                              { "workload", required_argument, nullptr, 'w' },
+                                              { "pattern", required_argument, nullptr, 'p' },
+                                              { "sizes", required_argument, nullptr, 's' },
+                                              { "threads", required_argument, nullptr, 't' },
+                                              { "ops", required_argument, nullptr, 'n' },
+                                              { "object-size", required_argument, nullptr, 0 },
+                                              { "seed", required_argument, nullptr, 0 },
+                                              { "mempool-reclaim", no_argument, nullptr, 0 },
+                                              { "csv", no_argument, nullptr, 0 },
+                                              { nullptr, 0, nullptr, 0 } };
+    while ( 1 ) {
+        int       opt_idx = 0;
+        const int intC    = getopt_long(argc, argv, "hv:w:p:s:t:n:", longOpts, &opt_idx);
+        if ( intC == -1 ) break;
+
+        switch ( intC ) {
+        case 'h':
+            printUsage(argv[0]);
+            return 1;
+        case 'v':
+            cfg.vortices = splitList(optarg);
+            break;
+        case 'w':
+            cfg.workloads = splitList(optarg);
+            break;
+        case 'p':
+            cfg.patterns = splitList(optarg);
+            break;
+        case 's':
+            cfg.sizes.clear();
+            for ( auto& x : splitList(optarg) )
+                cfg.sizes.push_back(strtoull(x.c_str(), nullptr, 0));
+            break;
+        case 't':
+            cfg.threads.clear();
+            for ( auto& x : splitList(optarg) )
+                cfg.threads.push_back(atoi(x.c_str()));
+            break;
+        case 'n':
+            cfg.ops = strtoull(optarg, nullptr, 0);
+            break;
+        case 0:
+        {
+            std::string name = longOpts[opt_idx].name;
+            if ( name == "suite" ) {
+                auto suites     = splitList(optarg);
+                cfg.run_vortex  = std::find(suites.begin(), suites.end(), "vortex") != suites.end();
+                cfg.run_mempool = std::find(suites.begin(), suites.end(), "mempool") != suites.end();
+            }
+            else if ( name == "object-size" ) {
+                cfg.object_size = strtoull(optarg, nullptr, 0);
+            }
+            else if ( name == "seed" ) {
+                cfg.seed = strtoul(optarg, nullptr, 0);
+            }
+            else if ( name == "mempool-reclaim" ) {
+                cfg.reclaim = true;
+            }
+            else if ( name == "csv" ) {
+                cfg.csv = true;
+            }
+            break;
+        }
+        default:
+            printUsage(argv[0]);
+            return -1;
+        }
+    }
+
+    if ( cfg.ops == 0 || cfg.object_size < sizeof(uint64_t) ) {
+        fprintf(stderr, "ERROR: --ops must be non-zero and --object-size at least %zu\n", sizeof(uint64_t));
+        return -1;
+    }
+    for ( auto size : cfg.sizes ) {
+        if ( size == 0 ) {
+            fprintf(stderr, "ERROR: sizes must be non-zero\n");
+            return -1;
+        }
+    }
+    for ( auto threads : cfg.threads ) {
+        if ( threads <= 0 ) {
+            fprintf(stderr, "ERROR: thread counts must be positive\n");
+            return -1;
+        }
+    }
+    return 0;
+}
+
+void
+printHeader(const BenchConfig& cfg, const char* kind, const char* column)
+{
+    if ( cfg.csv )
+        printf("benchmark,type,workload,size,threads,ops,ns_per_op,cache_misses_per_op,instructions_per_op\n");
+    else
+        printf(
+            "\n%-32s %-12s %10s %7s %10s %12s %12s\n", kind, column, "size", "threads", "ns/op", "misses/op",
+            "instr/op");
+}
+
+void
+printResult(
+    const BenchConfig& cfg, const char* bench, const std::string& type, const std::string& workload, uint64_t size,
+    int threads, const Result& result)
+{
+    char misses[32]       = "n/a";
+    char instructions[32] = "n/a";
+    if ( result.cache_misses_per_op >= 0 ) snprintf(misses, sizeof(misses), "%.3f", result.cache_misses_per_op);
+    if ( result.instructions_per_op >= 0 )
+        snprintf(instructions, sizeof(instructions), "%.1f", result.instructions_per_op);
+
+    if ( cfg.csv )
+        printf(
+            "%s,%s,%s,%" PRIu64 ",%d,%" PRIu64 ",%.2f,%s,%s\n", bench, type.c_str(), workload.c_str(), size, threads,
+            result.ops, result.ns_per_op, misses, instructions);
+    else
+        printf(
+            "%-32s %-12s %10" PRIu64 " %7d %10.2f %12s %12s\n", type.c_str(), workload.c_str(), size, threads,
+            result.ns_per_op, misses, instructions);
+    fflush(stdout);
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[])
+{
+    BenchConfig cfg;
+    int         ret = parseCmdLine(argc, argv, cfg);
+    if ( ret != 0 ) return ret < 0 ? 1 : 0;
+
+    // Only the built in elements are needed
+    Factory factory("");
+
+    if ( cfg.csv ) printHeader(cfg, nullptr, nullptr);
+
+    if ( cfg.run_vortex ) {
+        auto registered = ELI::InfoDatabase::getRegisteredElementNames<TimeVortex>();
+        std::sort(registered.begin(), registered.end());
+        if ( cfg.vortices.empty() ) {
+            // The thread safe versions are picked automatically, and
+            // the inbox vortex needs a running Simulation
+            for ( auto& name : registered ) {
+                if ( name.size() > 3 && name.compare(name.size() - 3, 3, ".ts") == 0 ) continue;
+                if ( name == "sst.timevortex.inbox" ) continue;
+                cfg.vortices.push_back(name);
+            }
+        }
+
+        if ( !cfg.csv ) printHeader(cfg, "TimeVortex", "workload");
+        for ( auto& type : cfg.vortices ) {
+            for ( auto& wl_name : cfg.workloads ) {
+                Workload workload;
+                if ( !parseWorkload(wl_name, workload) ) {
+                    fprintf(stderr, "ERROR: Unknown workload: %s\n", wl_name.c_str());
+                    return 1;
+                }
+                for ( auto size : cfg.sizes ) {
+                    for ( auto threads : cfg.threads ) {
+                        std::string name = type;
+                        if ( threads > 1 ) name += ".ts";
+                        if ( std::find(registered.begin(), registered.end(), name) == registered.end() ) {
+                            fprintf(stderr, "ERROR: Unknown TimeVortex: %s\n", name.c_str());
+                            return 1;
+                        }
+                        printResult(
+                            cfg, "vortex", name, wl_name, size, threads,
+                            benchVortex(name, workload, size, threads, cfg));
+                    }
+                }
+            }
+        }
+    }
+
+    if ( cfg.run_mempool ) {
+        if ( !cfg.csv ) printHeader(cfg, "MemPool", "pattern");
+        for ( auto& pat_name : cfg.patterns ) {
+            Pattern pattern;
+            if ( !parsePattern(pat_name, pattern) ) {
+                fprintf(stderr, "ERROR: Unknown pattern: %s\n", pat_name.c_str());
+                return 1;
+            }
+            for ( auto size : cfg.sizes ) {
+                for ( auto threads : cfg.threads ) {
+                    // Remote frees need pairs of threads.  Skip the
+                    // other counts rather than report a rounded count
+                    // that repeats another row.
+                    if ( pattern == Pattern::REMOTE && threads % 2 != 0 ) continue;
+#ifdef USE_MEMPOOL
+                    // Every run starts new threads, so each one gets
+                    // new pools created with the current setting
+                    Activity::memPoolReclaim = false;
+                    printResult(
+                        cfg, "mempool", "mempool", pat_name, size, threads, benchMemPool(pattern, size, threads, cfg));
+                    if ( cfg.reclaim ) {
+                        Activity::memPoolReclaim = true;
+                        printResult(
+                            cfg, "mempool", "mempool.reclaim", pat_name, size, threads,
+                            benchMemPool(pattern, size, threads, cfg));
+                    }
+#else
+                    printResult(
+                        cfg, "mempool", "malloc", pat_name, size, threads, benchMemPool(pattern, size, threads, cfg));
+#endif
+                }
+            }
+        }
+    }
+
+    return 0;
+}
@@ -20,6 +20,7 @@
 
 namespace SST {
 
+class Config;
 class ConfigGraph;
 class PartitionGraph;
 
@@ -59,6 +60,13 @@ public:
      */
     virtual void performPartition(ConfigGraph* graph);
 
+    /** Function to be overridden by subclasses that take options
+     * from the simulation configuration
+     *
+     * Called before performPartition() on every rank.
+     */
+    virtual void configure(const Config& UNUSED(cfg)) {}
+
     virtual bool requiresConfigGraph() { return false; }
 
     virtual bool spawnOnAllRanks() { return false; }
@@ -0,0 +1,493 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncNeighborSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/exit.h"
+#include "sst/core/link.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#ifdef SST_CONFIG_HAVE_MPI
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
+
+namespace SST {
+
+RankSyncNeighborSkip::RankSyncNeighborSkip(RankInfo num_ranks, TimeConverter* minPartTC) :
+    RankSync(num_ranks),
+    exit_pending(false),
+    exit_done(false),
+    mpiWaitTime(0.0),
+    deserializeTime(0.0)
+{
+    max_period   = minPartTC;
+    idle_period  = minPartTC->getFactor();
+    // The real first sync time isn't known until the lookaheads have
+    // been exchanged in finalizeLinkConfigurations()
+    nextSyncTime = idle_period;
+}
+
+RankSyncNeighborSkip::~RankSyncNeighborSkip()
+{
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        delete i->second.squeue;
+        delete[] i->second.rbuf;
+    }
+    comm_map.clear();
+
+    if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0, "RankSyncNeighborSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime,
+            deserializeTime);
+}
+
+ActivityQueue*
+RankSyncNeighborSkip::registerLink(
+    const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), const std::string& name, Link* link)
+{
+    SyncQueue* queue;
+    if ( comm_map.count(to_rank.rank) == 0 ) {
+        queue = comm_map[to_rank.rank].squeue = new SyncQueue();
+        comm_map[to_rank.rank].rbuf           = new char[4096];
+        comm_map[to_rank.rank].local_size     = 4096;
+        comm_map[to_rank.rank].remote_size    = 4096;
+        comm_map[to_rank.rank].send_latency   = MAX_SIMTIME_T;
+        comm_map[to_rank.rank].lookahead      = MAX_SIMTIME_T;
+        comm_map[to_rank.rank].time           = 0;
+        comm_map[to_rank.rank].done           = false;
+    }
+    else {
+        queue = comm_map[to_rank.rank].squeue;
+    }
+
+    // The link map is cleared after the link info exchange, so the
+    // latency has to be picked up here
+    SimTime_t latency = getSendLatency(link);
+    if ( latency < comm_map[to_rank.rank].send_latency ) comm_map[to_rank.rank].send_latency = latency;
+
+    link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    link->setSendingComponentInfo("SYNC", "SYNC", "");
+#endif
+    return queue;
+}
+
+void
+RankSyncNeighborSkip::finalizeLinkConfigurations()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Each side only knows the latencies of the links it sends on,
+    // so swap them with each neighbor to get the lookaheads
+    std::vector<SimTime_t> recv_lat(comm_map.size());
+    sreqs.resize(comm_map.size());
+    rreqs.resize(comm_map.size());
+    int count = 0;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        MPI_Isend(&i->second.send_latency, 1, MPI_UINT64_T, i->first, 3, MPI_COMM_WORLD, &sreqs[count]);
+        MPI_Irecv(&recv_lat[count], 1, MPI_UINT64_T, i->first, 3, MPI_COMM_WORLD, &rreqs[count]);
+        count++;
+    }
+    MPI_Waitall(count, rreqs.data(), MPI_STATUSES_IGNORE);
+    MPI_Waitall(count, sreqs.data(), MPI_STATUSES_IGNORE);
+
+    nextSyncTime = MAX_SIMTIME_T;
+    count        = 0;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        // A zero lookahead would never let the neighbors get past
+        // each other
+        i->second.lookahead = recv_lat[count] == 0 ? 1 : recv_lat[count];
+        count++;
+        if ( i->second.lookahead < nextSyncTime ) nextSyncTime = i->second.lookahead;
+    }
+    if ( nextSyncTime == MAX_SIMTIME_T ) nextSyncTime = idle_period;
+#endif
+}
+
+void
+RankSyncNeighborSkip::prepareForComplete()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Tell every neighbor we're done.  Anything still in the
+    // SyncQueues is past the end of simulation, but goes along so the
+    // messages are the same as during the run.
+    sreqs.resize(2 * comm_map.size());
+    int sreq_count = 0;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        sreq_count = postSend(i, MAX_SIMTIME_T, sreq_count);
+    }
+
+    // Post the receives for what the neighbors still send until their
+    // final messages.  A running neighbor can't get to its next exit
+    // check until its sends to us complete, so these have to be
+    // serviced while waiting on the checks.  The links are already in
+    // complete mode, so the events are dropped.
+    rreqs.resize(comm_map.size());
+    int rreq_count = 0;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.done ) { rreqs[rreq_count++] = MPI_REQUEST_NULL; }
+        else {
+            MPI_Irecv(
+                i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+        }
+    }
+
+    // Neighbors that are still running may need more exit checks to
+    // find out the simulation is over.  Keep taking part, as not
+    // running, until a check shows that no rank is running so every
+    // rank has done the same number of checks.
+    auto waitStart = SST::Core::Profile::now();
+    if ( exit_pending ) waitExitCheck();
+    SimTime_t active = Simulation_impl::getSimulation()->getExit()->getRefCount() > 0;
+    do {
+        startExitCheck(active, 0, 0);
+        waitExitCheck();
+    } while ( exit_out[2] != 0 );
+    exit_pending = false;
+
+    // Get the rest of the messages up to the final ones
+    drainRecvs(true);
+
+    MPI_Waitall(sreq_count, sreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+#endif
+}
+
+void
+RankSyncNeighborSkip::waitExitCheck()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    int flag = 0;
+    while ( true ) {
+        MPI_Test(&exit_req, &flag, MPI_STATUS_IGNORE);
+        if ( flag ) break;
+        drainRecvs(false);
+    }
+#endif
+}
+
+void
+RankSyncNeighborSkip::drainRecvs(bool UNUSED_WO_MPI(wait))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    int count = 0;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i, ++count ) {
+        while ( rreqs[count] != MPI_REQUEST_NULL ) {
+            int flag = 1;
+            if ( wait ) { MPI_Wait(&rreqs[count], MPI_STATUS_IGNORE); }
+            else {
+                MPI_Test(&rreqs[count], &flag, MPI_STATUS_IGNORE);
+            }
+            if ( !flag ) break;
+
+            char*              buffer = completeRecv(i);
+            SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
+            if ( hdr->time == MAX_SIMTIME_T ) { i->second.done = true; }
+            else {
+                MPI_Irecv(
+                    i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[count]);
+            }
+        }
+    }
+#endif
+}
+
+uint64_t
+RankSyncNeighborSkip::getDataSize() const
+{
+    size_t count = 0;
+    for ( comm_map_t::const_iterator it = comm_map.begin(); it != comm_map.end(); ++it ) {
+        count += (it->second.squeue->getDataSize() + it->second.local_size);
+    }
+    return count;
+}
+
+void
+RankSyncNeighborSkip::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncNeighborSkip::exchange(void)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    SimTime_t current_cycle = Simulation_impl::getSimulation()->getCurrentSimCycle();
+
+    // Maximum number of outstanding requests is 3 times the number
+    // of ranks I communicate with (1 recv, 2 sends per rank)
+    sreqs.resize(2 * comm_map.size());
+    rreqs.resize(comm_map.size());
+    int sreq_count = 0;
+    int rreq_count = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        // Neighbors that have finished don't take any more messages
+        // and anything sent to them is past the end of simulation
+        if ( i->second.done ) {
+            i->second.squeue->clear();
+            continue;
+        }
+        sreq_count = postSend(i, current_cycle, sreq_count);
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    nextSyncTime = MAX_SIMTIME_T;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.done ) continue;
+
+        char*              buffer = completeRecv(i);
+        SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
+
+        deliver(buffer);
+
+        if ( hdr->time == MAX_SIMTIME_T ) {
+            i->second.done = true;
+            continue;
+        }
+
+        // Nothing the neighbor sends from here on can arrive earlier
+        // than its current time plus its lookahead
+        i->second.time = hdr->time;
+        SimTime_t next = hdr->time > MAX_SIMTIME_T - i->second.lookahead ? MAX_SIMTIME_T
+                                                                          : hdr->time + i->second.lookahead;
+        if ( next < nextSyncTime ) nextSyncTime = next;
+    }
+
+    // Nobody left to wait on, but still need to sync now and then to
+    // take part in the exit checks
+    if ( nextSyncTime == MAX_SIMTIME_T ) nextSyncTime = current_cycle + idle_period;
+
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreq_count, sreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+#endif
+}
+
+int
+RankSyncNeighborSkip::postSend(
+    comm_map_t::iterator UNUSED_WO_MPI(it), SimTime_t UNUSED_WO_MPI(time), int sreq_count)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Get the buffer from the syncQueue
+    char*              send_buffer = it->second.squeue->getData();
+    // Cast to Header so we can get/fill in data
+    SyncQueue::Header* hdr         = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+    hdr->time                      = time;
+    int tag                        = 1;
+    // Check to see if remote queue is big enough for data
+    if ( it->second.remote_size < hdr->buffer_size ) {
+        // not big enough, send message that will tell remote side to get larger buffer
+        hdr->mode = 1;
+        MPI_Isend(
+            send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, it->first /*dest*/, tag, MPI_COMM_WORLD,
+            &sreqs[sreq_count++]);
+        it->second.remote_size = hdr->buffer_size;
+        tag                    = 2;
+    }
+    else {
+        hdr->mode = 0;
+    }
+    MPI_Isend(send_buffer, hdr->buffer_size, MPI_BYTE, it->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+#endif
+    return sreq_count;
+}
+
+char*
+RankSyncNeighborSkip::completeRecv(comm_map_t::iterator it)
+{
+    char* buffer = it->second.rbuf;
+#ifdef SST_CONFIG_HAVE_MPI
+    SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+    unsigned int       size = hdr->buffer_size;
+    int                mode = hdr->mode;
+
+    if ( mode == 1 ) {
+        // May need to resize the buffer
+        if ( size > it->second.local_size ) {
+            delete[] it->second.rbuf;
+            it->second.rbuf       = new char[size];
+            it->second.local_size = size;
+        }
+        auto waitStart = SST::Core::Profile::now();
+        MPI_Recv(it->second.rbuf, it->second.local_size, MPI_BYTE, it->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+        buffer = it->second.rbuf;
+    }
+#endif
+    return buffer;
+}
+
+void
+RankSyncNeighborSkip::deliver(char* buffer)
+{
+    SimTime_t current_cycle = Simulation_impl::getSimulation()->getCurrentSimCycle();
+
+    auto deserialStart = SST::Core::Profile::now();
+
+    SyncQueue::Header*                   hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
+    SST::Core::Serialization::serializer ser;
+    ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], hdr->buffer_size - sizeof(SyncQueue::Header));
+
+    std::vector<Activity*> activities;
+    ser&                   activities;
+
+    deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+    for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+        Event*    ev    = static_cast<Event*>(activities[j]);
+        SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+        getDeliveryLink(ev)->send(delay, ev);
+    }
+}
+
+void
+RankSyncNeighborSkip::checkExit(Exit* UNUSED_WO_MPI(exit))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Ranks get here at different simulated times, so a blocking
+    // collective would tie them back together.  The check started at
+    // one sync is picked up at a later one instead.
+    if ( exit_done ) {
+        // The check has already shown the run is over, but we were
+        // behind the end time.  Keep going until we get there without
+        // starting any more checks, since the finished ranks only
+        // take part in the one in prepareForComplete().
+        exit->setGlobalCount(0);
+        clampToEndTime(exit->getEndTime());
+        return;
+    }
+    exit->setGlobalCount(1);
+    if ( exit_pending ) {
+        int flag = 0;
+        MPI_Test(&exit_req, &flag, MPI_STATUS_IGNORE);
+        if ( !flag ) return;
+        exit_pending = false;
+
+        // Every rank gets the same result, so they all stop after the
+        // same check.  Each rank still has to run up to the end time
+        // before it stops.
+        if ( exit_out[0] == 0 ) {
+            exit_done = true;
+            exit->setEndTime(exit_out[1]);
+            exit->setGlobalCount(0);
+            clampToEndTime(exit_out[1]);
+            return;
+        }
+    }
+    startExitCheck(exit->getRefCount() > 0, exit->getEndTime(), 1);
+#endif
+}
+
+void
+RankSyncNeighborSkip::clampToEndTime(SimTime_t end_time)
+{
+    if ( end_time > Simulation_impl::getSimulation()->getCurrentSimCycle() && end_time < nextSyncTime ) {
+        nextSyncTime = end_time;
+    }
+}
+
+void
+RankSyncNeighborSkip::startExitCheck(
+    SimTime_t UNUSED_WO_MPI(active), SimTime_t UNUSED_WO_MPI(end_time), SimTime_t UNUSED_WO_MPI(running))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    exit_in[0] = active;
+    exit_in[1] = end_time;
+    exit_in[2] = running;
+    MPI_Iallreduce(exit_in, exit_out, 3, MPI_UINT64_T, MPI_MAX, MPI_COMM_WORLD, &exit_req);
+    exit_pending = true;
+#endif
+}
+
+void
+RankSyncNeighborSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atomic<int>& UNUSED_WO_MPI(msg_count))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( thread != 0 ) { return; }
+    // Maximum number of outstanding requests is 3 times the number of
+    // ranks I communicate with (1 recv, 2 sends per rank)
+    sreqs.resize(2 * comm_map.size());
+    rreqs.resize(comm_map.size());
+    int rreq_count = 0;
+    int sreq_count = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        // Do all the sends
+        sreq_count = postSend(i, 0, sreq_count);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    // Wait for all recvs to complete
+    MPI_Waitall(rreq_count, rreqs.data(), MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Get the buffer and deserialize all the events
+        char* buffer = completeRecv(i);
+
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(buffer);
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], hdr->buffer_size - sizeof(SyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event* ev = static_cast<Event*>(activities[j]);
+            sendUntimedData_sync(getDeliveryLink(ev), ev);
+        }
+    }
+
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    MPI_Waitall(sreq_count, sreqs.data(), MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    // Do an allreduce to see if there were any messages sent
+    int input = msg_count;
+
+    int count;
+    MPI_Allreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    msg_count = count;
+#endif
+}
+
+} // namespace SST
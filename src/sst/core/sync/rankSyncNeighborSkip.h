@@ -0,0 +1,164 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCNEIGHBORSKIP_H
+#define SST_CORE_SYNC_RANKSYNCNEIGHBORSKIP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class SyncQueue;
+class TimeConverter;
+
+/**
+ * RankSync that only synchronizes with the ranks it shares links
+ * with, using the minimum latency of the links from each of them as
+ * the lookahead for that neighbor (a conservative, null message style
+ * protocol).
+ *
+ * At every sync a rank sends one message to each neighbor, holding
+ * the events for that neighbor and the current time, then waits for
+ * the matching message from each neighbor.  Nothing sent by neighbor
+ * j after the time in its message can arrive before that time plus
+ * the latency from j, so the next sync is the minimum of that over
+ * all neighbors.  Ranks don't share a sync schedule, so loosely
+ * coupled parts of a system can run far ahead of each other.
+ *
+ * Since ranks reach their syncs at different simulated times, the
+ * exit check is a non-blocking allreduce that is started at one sync
+ * and picked up at a later one.  A rank that is done sends each
+ * neighbor a final message, then keeps receiving until it has a final
+ * message from each neighbor.
+ *
+ * Only thread 0 does any communication, so this is used for any
+ * number of threads per rank.
+ */
+class RankSyncNeighborSkip : public RankSync
+{
+public:
+    /** Create a new Sync object */
+    RankSyncNeighborSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncNeighborSkip();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue*
+         registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    void checkExit(Exit* exit) override;
+
+    uint64_t getDataSize() const override;
+
+private:
+    struct comm_pair
+    {
+        SyncQueue* squeue; // SyncQueue
+        char*      rbuf;   // receive buffer
+        uint32_t   local_size;
+        uint32_t   remote_size;
+        // Minimum latency of the links from us to the neighbor
+        SimTime_t  send_latency;
+        // Minimum latency of the links from the neighbor to us
+        SimTime_t  lookahead;
+        // Time in the last message from the neighbor
+        SimTime_t  time;
+        // Neighbor has sent its final message
+        bool       done;
+    };
+
+    typedef std::map<int, comm_pair> comm_map_t;
+
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /**
+       Post the sends of the current contents of a neighbor's
+       SyncQueue, stamped with time.  Returns the new number of
+       requests in sreqs.
+    */
+    int postSend(comm_map_t::iterator it, SimTime_t time, int sreq_count);
+
+    /**
+       Get the rest of a message whose header was received into the
+       receive buffer, growing the buffer if needed.  Returns the
+       buffer holding the full message.
+    */
+    char* completeRecv(comm_map_t::iterator it);
+
+    /** Deserialize the events in a message and send them on to their links */
+    void deliver(char* buffer);
+
+    /** Start a non-blocking exit check */
+    void startExitCheck(SimTime_t active, SimTime_t end_time, SimTime_t running);
+
+    /** Make sure the next sync is no later than the end time, if we are behind it */
+    void clampToEndTime(SimTime_t end_time);
+
+    /**
+       Wait for the exit check in flight to finish, servicing the
+       receives posted in prepareForComplete() meanwhile
+    */
+    void waitExitCheck();
+
+    /**
+       Complete the receives posted in prepareForComplete(), reposting
+       each until the neighbor's final message.  If wait is false, only
+       takes what has already arrived.
+    */
+    void drainRecvs(bool wait);
+
+    comm_map_t comm_map;
+
+    // Sync period used when no neighbor limits how far we can go, so
+    // we still take part in the exit checks
+    SimTime_t idle_period;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    std::vector<MPI_Request> sreqs;
+    std::vector<MPI_Request> rreqs;
+
+    // Exit check in flight: whether any primary components are
+    // still active, latest end time, whether the rank is still running
+    MPI_Request exit_req;
+    SimTime_t   exit_in[3];
+    SimTime_t   exit_out[3];
+#endif
+    bool exit_pending;
+    // An exit check has shown that the simulation is over
+    bool exit_done;
+
+    double mpiWaitTime;
+    double deserializeTime;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCNEIGHBORSKIP_H
@@ -0,0 +1,334 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncOverlapSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/link.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#ifdef SST_CONFIG_HAVE_MPI
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
+
+namespace SST {
+
+RankSyncOverlapSkip::RankSyncOverlapSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
+    RankSync(num_ranks),
+    in_flight(false),
+    mpiWaitTime(0.0),
+    deserializeTime(0.0)
+{
+    // SyncManager only uses this sync when the minimum partition
+    // latency is at least 2, so the period is never zero
+    max_period   = Simulation_impl::getSimulation()->getMinPartTC();
+    period       = max_period->getFactor() / 2;
+    nextSyncTime = period;
+}
+
+RankSyncOverlapSkip::~RankSyncOverlapSkip()
+{
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        delete i->second.squeue;
+        delete[] i->second.rbuf;
+    }
+    comm_map.clear();
+
+    if ( mpiWaitTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0, "RankSyncOverlapSkip mpiWait: %lg sec  deserializeWait:  %lg sec\n", mpiWaitTime,
+            deserializeTime);
+}
+
+ActivityQueue*
+RankSyncOverlapSkip::registerLink(
+    const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), const std::string& name, Link* link)
+{
+    SyncQueue* queue;
+    if ( comm_map.count(to_rank.rank) == 0 ) {
+        queue = comm_map[to_rank.rank].squeue = new SyncQueue();
+        comm_map[to_rank.rank].rbuf           = new char[4096];
+        comm_map[to_rank.rank].local_size     = 4096;
+        comm_map[to_rank.rank].remote_size    = 4096;
+    }
+    else {
+        queue = comm_map[to_rank.rank].squeue;
+    }
+
+    link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    link->setSendingComponentInfo("SYNC", "SYNC", "");
+#endif
+    return queue;
+}
+
+void
+RankSyncOverlapSkip::finalizeLinkConfigurations()
+{}
+
+void
+RankSyncOverlapSkip::prepareForComplete()
+{
+    // The links are already in complete mode, so anything still in
+    // flight is past the end of simulation and just gets dropped
+    if ( in_flight ) finishExchange(false);
+}
+
+uint64_t
+RankSyncOverlapSkip::getDataSize() const
+{
+    size_t count = 0;
+    for ( comm_map_t::const_iterator it = comm_map.begin(); it != comm_map.end(); ++it ) {
+        count += (it->second.squeue->getDataSize() + it->second.local_size);
+    }
+    return count;
+}
+
+void
+RankSyncOverlapSkip::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncOverlapSkip::exchange(void)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Everything posted at the last sync is due at or after the
+    // current time, so needs to be in the TimeVortex before we go on
+    if ( in_flight ) finishExchange(true);
+
+    // Post the exchange for the window that just ended before the
+    // allreduce so the data moves while we wait on the other ranks
+    SimTime_t min_sent = startExchange();
+
+    // Next sync is one period past the earliest activity anywhere,
+    // but can't be after the earliest event still in flight
+    SimTime_t input[2] = { Simulation_impl::getLocalMinimumNextActivityTime(), min_sent };
+    SimTime_t min_time[2];
+    MPI_Allreduce(input, min_time, 2, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+
+    nextSyncTime = min_time[0] > MAX_SIMTIME_T - period ? MAX_SIMTIME_T : min_time[0] + period;
+    if ( min_time[1] < nextSyncTime ) nextSyncTime = min_time[1];
+#endif
+}
+
+SimTime_t
+RankSyncOverlapSkip::startExchange()
+{
+    SimTime_t min_sent = MAX_SIMTIME_T;
+#ifdef SST_CONFIG_HAVE_MPI
+    // Maximum number of outstanding requests is 3 times the number
+    // of ranks I communicate with (1 recv, 2 sends per rank)
+    sreqs.resize(2 * comm_map.size());
+    rreqs.resize(comm_map.size());
+    int sreq_count = 0;
+    int rreq_count = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Get the buffer from the syncQueue.  It stays untouched until
+        // the next exchange, new events go into the other buffer.
+        SimTime_t min_time;
+        char*     send_buffer = i->second.squeue->swapData(min_time);
+        if ( min_time < min_sent ) min_sent = min_time;
+
+        // Cast to Header so we can get/fill in data
+        SyncQueue::Header* hdr = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+    sreqs.resize(sreq_count);
+    in_flight = true;
+#endif
+    return min_sent;
+}
+
+void
+RankSyncOverlapSkip::finishExchange(bool UNUSED_WO_MPI(deliver))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreqs.size(), rreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    SimTime_t current_cycle = Simulation_impl::getSimulation()->getCurrentSimCycle();
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        // Get the buffer and deserialize all the events
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size = hdr->buffer_size;
+        int                mode = hdr->mode;
+
+        if ( mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            waitStart = SST::Core::Profile::now();
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+            buffer = i->second.rbuf;
+        }
+
+        if ( !deliver ) continue;
+
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event*    ev    = static_cast<Event*>(activities[j]);
+            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+            getDeliveryLink(ev)->send(delay, ev);
+        }
+    }
+
+    // The send buffers get reused by the next swapData(), so the sends
+    // have to be done too
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreqs.size(), sreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    in_flight = false;
+#endif
+}
+
+void
+RankSyncOverlapSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atomic<int>& UNUSED_WO_MPI(msg_count))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( thread != 0 ) { return; }
+    // Maximum number of outstanding requests is 3 times the number of
+    // ranks I communicate with (1 recv, 2 sends per rank)
+    sreqs.resize(2 * comm_map.size());
+    rreqs.resize(comm_map.size());
+    int rreq_count = 0;
+    int sreq_count = 0;
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Do all the sends
+        // Get the buffer from the syncQueue
+        char*              send_buffer = i->second.squeue->getData();
+        // Cast to Header so we can get/fill in data
+        SyncQueue::Header* hdr         = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        int                tag         = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        else {
+            hdr->mode = 0;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+
+    // Wait for all recvs to complete
+    MPI_Waitall(rreq_count, rreqs.data(), MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Get the buffer and deserialize all the events
+        char* buffer = i->second.rbuf;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(buffer);
+        unsigned int       size = hdr->buffer_size;
+        int                mode = hdr->mode;
+
+        if ( mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+            buffer = i->second.rbuf;
+        }
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], size - sizeof(SyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event* ev = static_cast<Event*>(activities[j]);
+            sendUntimedData_sync(getDeliveryLink(ev), ev);
+        }
+    }
+
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    MPI_Waitall(sreq_count, sreqs.data(), MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+
+    // Do an allreduce to see if there were any messages sent
+    int input = msg_count;
+
+    int count;
+    MPI_Allreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    msg_count = count;
+#endif
+}
+
+} // namespace SST
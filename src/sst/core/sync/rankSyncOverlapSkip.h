@@ -0,0 +1,112 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCOVERLAPSKIP_H
+#define SST_CORE_SYNC_RANKSYNCOVERLAPSKIP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class SyncQueue;
+class TimeConverter;
+
+/**
+ * RankSync that overlaps the exchange of events between ranks with
+ * execution.  The sends and receives posted at a sync are not waited
+ * on until the next sync, and the SyncQueues pack into a second
+ * buffer in the meantime.
+ *
+ * An event posted at a sync was sent no earlier than the sync
+ * before it, so is delivered at least one minimum partition latency
+ * after that.  Keeping the distance between consecutive syncs to at
+ * most half the minimum partition latency means everything in flight
+ * is received before it is due.  When skipping ahead, the next sync
+ * is also never later than the earliest event still in flight.
+ *
+ * Only thread 0 does any communication, so this is used for any
+ * number of threads per rank.
+ */
+class RankSyncOverlapSkip : public RankSync
+{
+public:
+    /** Create a new Sync object which fires with half the minimum partition latency */
+    RankSyncOverlapSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncOverlapSkip();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue*
+         registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    uint64_t getDataSize() const override;
+
+private:
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /** Post the sends and receives for the current window */
+    SimTime_t startExchange();
+
+    /**
+       Wait for the sends and receives posted at the last sync.  The
+       received events are only delivered if deliver is true.
+    */
+    void finishExchange(bool deliver);
+
+    struct comm_pair
+    {
+        SyncQueue* squeue; // SyncQueue
+        char*      rbuf;   // receive buffer
+        uint32_t   local_size;
+        uint32_t   remote_size;
+    };
+
+    typedef std::map<int, comm_pair> comm_map_t;
+
+    comm_map_t comm_map;
+
+    // Time between syncs
+    SimTime_t period;
+    // Whether there is an exchange waiting to be finished
+    bool      in_flight;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    std::vector<MPI_Request> sreqs;
+    std::vector<MPI_Request> rreqs;
+#endif
+
+    double mpiWaitTime;
+    double deserializeTime;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCOVERLAPSKIP_H
@@ -0,0 +1,499 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/rankSyncShmSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/interprocess/sstmutex.h"
+#include "sst/core/link.h"
+#include "sst/core/profile.h"
+#include "sst/core/serialization/serializer.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/sync/syncQueue.h"
+#include "sst/core/timeConverter.h"
+#include "sst/core/warnmacros.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#ifdef SST_CONFIG_HAVE_MPI
+#define UNUSED_WO_MPI(x) x
+#else
+#define UNUSED_WO_MPI(x) UNUSED(x)
+#endif
+
+// Size of the data area of each ring
+#define SHM_RING_SIZE (256 * 1024)
+
+namespace SST {
+
+/**
+   Single producer, single consumer byte ring.  head and tail are the
+   total number of bytes written and read, so they never wrap and the
+   ring is empty when they are equal.  They are kept on separate cache
+   lines so the two sides don't fight over them.
+*/
+struct RankSyncShmSkip::ShmRing
+{
+    std::atomic<uint64_t> head;
+    char                  pad0[64 - sizeof(std::atomic<uint64_t>)];
+    std::atomic<uint64_t> tail;
+    char                  pad1[64 - sizeof(std::atomic<uint64_t>)];
+    char                  data[SHM_RING_SIZE];
+
+    /** Write up to len bytes, returns the number written */
+    size_t write(const char* src, size_t len)
+    {
+        uint64_t h    = head.load(std::memory_order_relaxed);
+        uint64_t t    = tail.load(std::memory_order_acquire);
+        size_t   free = SHM_RING_SIZE - (h - t);
+        if ( len > free ) len = free;
+        if ( len == 0 ) return 0;
+
+        size_t pos   = h % SHM_RING_SIZE;
+        size_t first = std::min(len, (size_t)SHM_RING_SIZE - pos);
+        memcpy(&data[pos], src, first);
+        memcpy(&data[0], src + first, len - first);
+        head.store(h + len, std::memory_order_release);
+        return len;
+    }
+
+    /** Read up to len bytes, returns the number read */
+    size_t read(char* dst, size_t len)
+    {
+        uint64_t t     = tail.load(std::memory_order_relaxed);
+        uint64_t h     = head.load(std::memory_order_acquire);
+        size_t   avail = h - t;
+        if ( len > avail ) len = avail;
+        if ( len == 0 ) return 0;
+
+        size_t pos   = t % SHM_RING_SIZE;
+        size_t first = std::min(len, (size_t)SHM_RING_SIZE - pos);
+        memcpy(dst, &data[pos], first);
+        memcpy(dst + first, &data[0], len - first);
+        tail.store(t + len, std::memory_order_release);
+        return len;
+    }
+};
+
+RankSyncShmSkip::RankSyncShmSkip(RankInfo num_ranks, TimeConverter* UNUSED(minPartTC)) :
+    RankSync(num_ranks),
+    shm_setup(false),
+    shm_region(nullptr),
+    shm_size(0),
+    mpiWaitTime(0.0),
+    shmWaitTime(0.0),
+    deserializeTime(0.0),
+    shm_bytes(0),
+    mpi_bytes(0)
+{
+    max_period   = Simulation_impl::getSimulation()->getMinPartTC();
+    nextSyncTime = max_period->getFactor();
+}
+
+RankSyncShmSkip::~RankSyncShmSkip()
+{
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        delete i->second.squeue;
+        delete[] i->second.rbuf;
+    }
+    comm_map.clear();
+
+    if ( shm_region != nullptr ) munmap(shm_region, shm_size);
+
+    if ( mpiWaitTime > 0.0 || shmWaitTime > 0.0 || deserializeTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0,
+            "RankSyncShmSkip mpiWait: %lg sec  shmWait: %lg sec  deserializeWait:  %lg sec  shm bytes: %" PRIu64
+            "  mpi bytes: %" PRIu64 "\n",
+            mpiWaitTime, shmWaitTime, deserializeTime, shm_bytes, mpi_bytes);
+}
+
+ActivityQueue*
+RankSyncShmSkip::registerLink(
+    const RankInfo& to_rank, const RankInfo& UNUSED(from_rank), const std::string& name, Link* link)
+{
+    SyncQueue* queue;
+    if ( comm_map.count(to_rank.rank) == 0 ) {
+        queue = comm_map[to_rank.rank].squeue = new SyncQueue();
+        comm_map[to_rank.rank].rbuf           = new char[4096];
+        comm_map[to_rank.rank].local_size     = 4096;
+        comm_map[to_rank.rank].remote_size    = 4096;
+        comm_map[to_rank.rank].out            = nullptr;
+        comm_map[to_rank.rank].in             = nullptr;
+    }
+    else {
+        queue = comm_map[to_rank.rank].squeue;
+    }
+
+    link_maps[to_rank.rank][name] = reinterpret_cast<uintptr_t>(link);
+#ifdef __SST_DEBUG_EVENT_TRACKING__
+    link->setSendingComponentInfo("SYNC", "SYNC", "");
+#endif
+    return queue;
+}
+
+void
+RankSyncShmSkip::setupSharedMemory()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    shm_setup = true;
+
+    MPI_Comm node_comm;
+    MPI_Comm_split_type(MPI_COMM_WORLD, MPI_COMM_TYPE_SHARED, 0, MPI_INFO_NULL, &node_comm);
+    int node_rank;
+    int node_size;
+    MPI_Comm_rank(node_comm, &node_rank);
+    MPI_Comm_size(node_comm, &node_size);
+
+    // Find which world ranks are on this node and which of them are
+    // neighbors of each other
+    int              my_rank = Simulation_impl::getSimulation()->getRank().rank;
+    std::vector<int> world_ranks(node_size);
+    MPI_Allgather(&my_rank, 1, MPI_INT, world_ranks.data(), 1, MPI_INT, node_comm);
+
+    std::vector<char> my_neighbors(node_size, 0);
+    for ( int i = 0; i < node_size; ++i ) {
+        if ( comm_map.count(world_ranks[i]) != 0 ) my_neighbors[i] = 1;
+    }
+    std::vector<char> neighbors(node_size * node_size);
+    MPI_Allgather(my_neighbors.data(), node_size, MPI_CHAR, neighbors.data(), node_size, MPI_CHAR, node_comm);
+
+    // Every rank numbers the rings the same way, one for each
+    // direction of each neighboring pair
+    std::vector<int> ring_index(node_size * node_size, -1);
+    int              num_rings = 0;
+    for ( int i = 0; i < node_size; ++i ) {
+        for ( int j = 0; j < node_size; ++j ) {
+            if ( neighbors[i * node_size + j] && neighbors[j * node_size + i] ) {
+                ring_index[i * node_size + j] = num_rings++;
+            }
+        }
+    }
+
+    if ( num_rings == 0 ) {
+        MPI_Comm_free(&node_comm);
+        return;
+    }
+
+    Output& out = Simulation_impl::getSimulationOutput();
+    shm_size    = num_rings * sizeof(ShmRing);
+
+    // The lowest rank on the node creates the region, the others map
+    // it once they know its name
+    char name[256];
+    int  fd = -1;
+    if ( node_rank == 0 ) {
+        do {
+            snprintf(name, sizeof(name), "/sst_sync_%u-%d", getpid(), rand());
+            fd = shm_open(name, O_RDWR | O_CREAT | O_EXCL, S_IRUSR | S_IWUSR);
+        } while ( (fd < 0) && (errno == EEXIST) );
+        if ( fd < 0 ) {
+            out.fatal(CALL_INFO, 1, "Failed to create shared memory region '%s': %s\n", name, strerror(errno));
+        }
+        // A new file is all zeros, which is the empty state for all
+        // the rings
+        if ( ftruncate(fd, shm_size) ) {
+            out.fatal(CALL_INFO, 1, "Resizing shared memory region '%s' failed: %s\n", name, strerror(errno));
+        }
+    }
+    MPI_Bcast(name, sizeof(name), MPI_CHAR, 0, node_comm);
+    if ( node_rank != 0 ) {
+        fd = shm_open(name, O_RDWR, S_IRUSR | S_IWUSR);
+        if ( fd < 0 ) {
+            out.fatal(CALL_INFO, 1, "Failed to open shared memory region '%s': %s\n", name, strerror(errno));
+        }
+    }
+
+    shm_region = mmap(nullptr, shm_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if ( shm_region == MAP_FAILED ) out.fatal(CALL_INFO, 1, "mmap of '%s' failed: %s\n", name, strerror(errno));
+    close(fd);
+
+    // Once everyone has it mapped the name isn't needed, and removing
+    // it now means it goes away even if the run doesn't end cleanly
+    MPI_Barrier(node_comm);
+    if ( node_rank == 0 ) shm_unlink(name);
+
+    ShmRing* rings = static_cast<ShmRing*>(shm_region);
+    for ( int i = 0; i < node_size; ++i ) {
+        if ( ring_index[node_rank * node_size + i] < 0 ) continue;
+        comm_pair& pair = comm_map[world_ranks[i]];
+        pair.out        = &rings[ring_index[node_rank * node_size + i]];
+        pair.in         = &rings[ring_index[i * node_size + node_rank]];
+    }
+
+    MPI_Comm_free(&node_comm);
+#endif
+}
+
+void
+RankSyncShmSkip::finalizeLinkConfigurations()
+{}
+
+void
+RankSyncShmSkip::prepareForComplete()
+{}
+
+uint64_t
+RankSyncShmSkip::getDataSize() const
+{
+    size_t count = 0;
+    for ( comm_map_t::const_iterator it = comm_map.begin(); it != comm_map.end(); ++it ) {
+        count += (it->second.squeue->getDataSize() + it->second.local_size);
+    }
+    return count;
+}
+
+void
+RankSyncShmSkip::execute(int thread)
+{
+    if ( thread == 0 ) { exchange(); }
+}
+
+void
+RankSyncShmSkip::transfer()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( !shm_setup ) setupSharedMemory();
+
+    // Maximum number of outstanding requests is 3 times the number
+    // of ranks I communicate with (1 recv, 2 sends per rank)
+    sreqs.resize(2 * comm_map.size());
+    rreqs.resize(comm_map.size());
+    int sreq_count = 0;
+    int rreq_count = 0;
+
+    // Post the MPI sends and receives first so the data to other
+    // nodes moves while the local data goes through the rings
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        // Get the buffer from the syncQueue
+        char*              send_buffer = i->second.squeue->getData();
+        // Cast to Header so we can get/fill in data
+        SyncQueue::Header* hdr         = reinterpret_cast<SyncQueue::Header*>(send_buffer);
+        hdr->mode                      = 0;
+
+        if ( i->second.out != nullptr ) {
+            i->second.sbuf      = send_buffer;
+            i->second.sent      = 0;
+            i->second.send_size = hdr->buffer_size;
+            i->second.recvd     = 0;
+            i->second.recv_size = sizeof(SyncQueue::Header);
+            shm_bytes += hdr->buffer_size;
+            continue;
+        }
+
+        mpi_bytes += hdr->buffer_size;
+        int tag = 1;
+        // Check to see if remote queue is big enough for data
+        if ( i->second.remote_size < hdr->buffer_size ) {
+            // not big enough, send message that will tell remote side to get larger buffer
+            hdr->mode = 1;
+            MPI_Isend(
+                send_buffer, sizeof(SyncQueue::Header), MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD,
+                &sreqs[sreq_count++]);
+            i->second.remote_size = hdr->buffer_size;
+            tag                   = 2;
+        }
+        MPI_Isend(
+            send_buffer, hdr->buffer_size, MPI_BYTE, i->first /*dest*/, tag, MPI_COMM_WORLD, &sreqs[sreq_count++]);
+
+        // Post all the receives
+        MPI_Irecv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 1, MPI_COMM_WORLD, &rreqs[rreq_count++]);
+    }
+    sreqs.resize(sreq_count);
+
+    auto waitStart = SST::Core::Profile::now();
+    transferShared();
+    shmWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    waitStart = SST::Core::Profile::now();
+    MPI_Waitall(rreq_count, rreqs.data(), MPI_STATUSES_IGNORE);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.in != nullptr ) continue;
+
+        SyncQueue::Header* hdr  = reinterpret_cast<SyncQueue::Header*>(i->second.rbuf);
+        unsigned int       size = hdr->buffer_size;
+
+        if ( hdr->mode == 1 ) {
+            // May need to resize the buffer
+            if ( size > i->second.local_size ) {
+                delete[] i->second.rbuf;
+                i->second.rbuf       = new char[size];
+                i->second.local_size = size;
+            }
+            MPI_Recv(i->second.rbuf, i->second.local_size, MPI_BYTE, i->first, 2, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+        }
+    }
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+#endif
+}
+
+void
+RankSyncShmSkip::transferShared()
+{
+    size_t pending = 0;
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        if ( i->second.out != nullptr ) pending++;
+    }
+
+    // All the rings are worked on at once, since a neighbor can't
+    // empty the ring we're writing to until it has room in the ring
+    // it's writing to us
+    Core::Interprocess::SSTMutex backoff;
+    int                          loop_counter = 0;
+    while ( pending > 0 ) {
+        bool progress = false;
+        for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+            comm_pair& pair = i->second;
+            if ( pair.out == nullptr ) continue;
+            if ( pair.sent == pair.send_size && pair.recvd == pair.recv_size ) continue;
+
+            if ( pair.sent < pair.send_size ) {
+                size_t count = pair.out->write(pair.sbuf + pair.sent, pair.send_size - pair.sent);
+                pair.sent += count;
+                progress |= count > 0;
+            }
+
+            if ( pair.recvd < pair.recv_size ) {
+                size_t count = pair.in->read(pair.rbuf + pair.recvd, pair.recv_size - pair.recvd);
+                pair.recvd += count;
+                progress |= count > 0;
+
+                // Once the header is in we know how much more is coming
+                if ( pair.recvd == sizeof(SyncQueue::Header) && pair.recv_size == sizeof(SyncQueue::Header) ) {
+                    uint32_t size = reinterpret_cast<SyncQueue::Header*>(pair.rbuf)->buffer_size;
+                    if ( size > pair.local_size ) {
+                        char* buffer = new char[size];
+                        memcpy(buffer, pair.rbuf, sizeof(SyncQueue::Header));
+                        delete[] pair.rbuf;
+                        pair.rbuf       = buffer;
+                        pair.local_size = size;
+                    }
+                    pair.recv_size = size;
+                }
+            }
+
+            if ( pair.sent == pair.send_size && pair.recvd == pair.recv_size ) pending--;
+        }
+
+        if ( progress ) { loop_counter = 0; }
+        else {
+            backoff.processorPause(loop_counter++);
+        }
+    }
+}
+
+void
+RankSyncShmSkip::finishSends()
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    // Clear the SyncQueues used to send the data after all the sends have completed
+    auto waitStart = SST::Core::Profile::now();
+    MPI_Waitall(sreqs.size(), sreqs.data(), MPI_STATUSES_IGNORE);
+    mpiWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        i->second.squeue->clear();
+    }
+#endif
+}
+
+void
+RankSyncShmSkip::exchange(void)
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    transfer();
+
+    SimTime_t current_cycle = Simulation_impl::getSimulation()->getCurrentSimCycle();
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+        // Get the buffer and deserialize all the events
+        char*              buffer = i->second.rbuf;
+        SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
+
+        auto deserialStart = SST::Core::Profile::now();
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], hdr->buffer_size - sizeof(SyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+
+        deserializeTime += SST::Core::Profile::getElapsed(deserialStart);
+
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event*    ev    = static_cast<Event*>(activities[j]);
+            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+            getDeliveryLink(ev)->send(delay, ev);
+        }
+    }
+
+    finishSends();
+
+    // Check to see when the next event is scheduled, then do an
+    // all_reduce with min operator and set next sync time to be
+    // min + max_period.
+    SimTime_t input = Simulation_impl::getLocalMinimumNextActivityTime();
+    SimTime_t min_time;
+    MPI_Allreduce(&input, &min_time, 1, MPI_UINT64_T, MPI_MIN, MPI_COMM_WORLD);
+
+    nextSyncTime = min_time + max_period->getFactor();
+#endif
+}
+
+void
+RankSyncShmSkip::exchangeLinkUntimedData(int UNUSED_WO_MPI(thread), std::atomic<int>& UNUSED_WO_MPI(msg_count))
+{
+#ifdef SST_CONFIG_HAVE_MPI
+    if ( thread != 0 ) { return; }
+
+    transfer();
+
+    for ( comm_map_t::iterator i = comm_map.begin(); i != comm_map.end(); ++i ) {
+
+        // Get the buffer and deserialize all the events
+        char*              buffer = i->second.rbuf;
+        SyncQueue::Header* hdr    = reinterpret_cast<SyncQueue::Header*>(buffer);
+
+        SST::Core::Serialization::serializer ser;
+        ser.start_unpacking(&buffer[sizeof(SyncQueue::Header)], hdr->buffer_size - sizeof(SyncQueue::Header));
+
+        std::vector<Activity*> activities;
+        ser&                   activities;
+        for ( unsigned int j = 0; j < activities.size(); j++ ) {
+
+            Event* ev = static_cast<Event*>(activities[j]);
+            sendUntimedData_sync(getDeliveryLink(ev), ev);
+        }
+    }
+
+    finishSends();
+
+    // Do an allreduce to see if there were any messages sent
+    int input = msg_count;
+
+    int count;
+    MPI_Allreduce(&input, &count, 1, MPI_INT, MPI_SUM, MPI_COMM_WORLD);
+    msg_count = count;
+#endif
+}
+
+} // namespace SST
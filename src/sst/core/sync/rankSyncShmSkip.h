@@ -0,0 +1,134 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_RANKSYNCSHMSKIP_H
+#define SST_CORE_SYNC_RANKSYNCSHMSKIP_H
+
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/threadsafe.h"
+#include "sst/core/warnmacros.h"
+
+#include <map>
+#include <vector>
+
+#ifdef SST_CONFIG_HAVE_MPI
+DISABLE_WARN_MISSING_OVERRIDE
+#include <mpi.h>
+REENABLE_WARNING
+#endif
+
+namespace SST {
+
+class SyncQueue;
+class TimeConverter;
+
+/**
+ * RankSync that moves the sync buffers between ranks on the same node
+ * through shared memory instead of MPI.  Ranks on other nodes are
+ * still reached through MPI.
+ *
+ * The ranks on a node map one POSIX shared memory region, with a
+ * single producer, single consumer byte ring for each direction of
+ * every pair of neighboring ranks.  Buffers larger than a ring are
+ * streamed through it, so the rings don't limit the size of a sync.
+ * Sync timing is the same as RankSyncSerialSkip: all ranks sync
+ * together and skip ahead to one minimum partition latency past the
+ * earliest pending activity.
+ *
+ * Only thread 0 does any communication, so this is used for any
+ * number of threads per rank.
+ */
+class RankSyncShmSkip : public RankSync
+{
+public:
+    /** Create a new Sync object which fires with a specified period */
+    RankSyncShmSkip(RankInfo num_ranks, TimeConverter* minPartTC);
+    virtual ~RankSyncShmSkip();
+
+    /** Register a Link which this Sync Object is responsible for */
+    ActivityQueue*
+         registerLink(const RankInfo& to_rank, const RankInfo& from_rank, const std::string& name, Link* link) override;
+    void execute(int thread) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void exchangeLinkUntimedData(int thread, std::atomic<int>& msg_count) override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    /** Prepare for the complete() stage */
+    void prepareForComplete() override;
+
+    uint64_t getDataSize() const override;
+
+private:
+    /** One direction of the shared memory channel between two ranks */
+    struct ShmRing;
+
+    struct comm_pair
+    {
+        SyncQueue* squeue; // SyncQueue
+        char*      rbuf;   // receive buffer
+        uint32_t   local_size;
+        uint32_t   remote_size;
+        // Shared memory rings, nullptr if the rank is on another node
+        ShmRing*   out;
+        ShmRing*   in;
+        // Progress of the current transfer through the rings
+        char*      sbuf;
+        uint32_t   sent;
+        uint32_t   send_size;
+        uint32_t   recvd;
+        uint32_t   recv_size;
+    };
+
+    typedef std::map<int, comm_pair> comm_map_t;
+
+    // Function that actually does the exchange during run
+    void exchange();
+
+    /** Map the shared memory region and find the rings for the neighbors on this node */
+    void setupSharedMemory();
+
+    /**
+       Send the SyncQueues to all neighbors and receive from all of
+       them into the receive buffers.  The MPI sends are left
+       outstanding for finishSends().
+    */
+    void transfer();
+
+    /** Move data through the shared memory rings until all of it has gone */
+    void transferShared();
+
+    /** Wait on the MPI sends and clear the SyncQueues */
+    void finishSends();
+
+    comm_map_t comm_map;
+
+    // Whether the shared memory region has been set up
+    bool   shm_setup;
+    void*  shm_region;
+    size_t shm_size;
+
+#ifdef SST_CONFIG_HAVE_MPI
+    std::vector<MPI_Request> sreqs;
+    std::vector<MPI_Request> rreqs;
+#endif
+
+    double   mpiWaitTime;
+    double   shmWaitTime;
+    double   deserializeTime;
+    uint64_t shm_bytes;
+    uint64_t mpi_bytes;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_RANKSYNCSHMSKIP_H
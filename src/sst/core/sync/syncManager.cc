@@ -17,9 +17,13 @@
 #include "sst/core/objectComms.h"
 #include "sst/core/profile/syncProfileTool.h"
 #include "sst/core/simulation_impl.h"
+#include "sst/core/sync/rankSyncNeighborSkip.h"
+#include "sst/core/sync/rankSyncOverlapSkip.h"
 #include "sst/core/sync/rankSyncParallelSkip.h"
 #include "sst/core/sync/rankSyncSerialSkip.h"
+#include "sst/core/sync/rankSyncShmSkip.h"
 #include "sst/core/sync/threadSyncDirectSkip.h"
+#include "sst/core/sync/threadSyncNeighborSkip.h"
 #include "sst/core/sync/threadSyncQueue.h"
 #include "sst/core/sync/threadSyncSimpleSkip.h"
 #include "sst/core/timeConverter.h"
@@ -145,6 +149,12 @@ public:
     }
 };
 
+void
+RankSync::checkExit(Exit* exit)
+{
+    exit->check();
+}
+
 void
 RankSync::exchangeLinkInfo(uint32_t UNUSED_WO_MPI(my_rank))
 {
@@ -238,26 +248,47 @@ private:
 
 SyncManager::SyncManager(
     const RankInfo& rank, const RankInfo& num_ranks, TimeConverter* minPartTC, SimTime_t min_part,
-    const std::vector<SimTime_t>& UNUSED(interThreadLatencies)) :
+    const std::vector<SimTime_t>& interThreadLatencies) :
     Action(),
     rank(rank),
     num_ranks(num_ranks),
     threadSync(nullptr),
-    min_part(min_part)
+    min_part(min_part),
+    thread_sync_neighbor(false)
 {
     sim = Simulation_impl::getSimulation();
 
+    rank_sync_neighbor = sim->rank_sync_neighbor && min_part != MAX_SIMTIME_T;
+
     if ( rank.thread == 0 ) {
         for ( auto& b : RankExecBarrier ) {
             b.resize(num_ranks.thread);
+            b.setHybrid(sim->hybrid_barriers);
         }
         for ( auto& b : LinkUntimedBarrier ) {
             b.resize(num_ranks.thread);
+            b.setHybrid(sim->hybrid_barriers);
         }
         if ( min_part != MAX_SIMTIME_T ) {
-            if ( num_ranks.thread == 1 ) { rankSync = new RankSyncSerialSkip(num_ranks, minPartTC); }
+            if ( sim->rank_sync_neighbor ) { rankSync = new RankSyncNeighborSkip(num_ranks, minPartTC); }
+            else if ( sim->rank_sync_shmem ) {
+                rankSync = new RankSyncShmSkip(num_ranks, minPartTC);
+            }
+            // Overlapping syncs happen every half min_part, so need
+            // min_part to be at least 2
+            else if ( sim->rank_sync_overlap && min_part >= 2 ) {
+                rankSync = new RankSyncOverlapSkip(num_ranks, minPartTC);
+            }
             else {
-                rankSync = new RankSyncParallelSkip(num_ranks, minPartTC);
+                if ( sim->rank_sync_overlap && rank.rank == 0 ) {
+                    sim->getSimulationOutput().output(
+                        "WARNING: --rank-sync-overlap needs a minimum partition latency of at least 2 core time "
+                        "units, using the regular rank sync\n");
+                }
+                if ( num_ranks.thread == 1 ) { rankSync = new RankSyncSerialSkip(num_ranks, minPartTC); }
+                else {
+                    rankSync = new RankSyncParallelSkip(num_ranks, minPartTC);
+                }
             }
         }
         else {
@@ -270,10 +301,22 @@ SyncManager::SyncManager(
     // of the active threadsyncs.
     SimTime_t interthread_minlat = sim->getInterThreadMinLatency();
     if ( num_ranks.thread > 1 && interthread_minlat != MAX_SIMTIME_T ) {
-        if ( Simulation_impl::getSimulation()->direct_interthread ) {
+        // Threads aren't held together by the neighbor sync, so it
+        // can't be mixed with rank syncs
+        if ( sim->thread_sync_neighbor && min_part == MAX_SIMTIME_T ) {
+            threadSync = new ThreadSyncNeighborSkip(
+                num_ranks.thread, rank.thread, Simulation_impl::getSimulation(), interThreadLatencies);
+            thread_sync_neighbor = true;
+        }
+        else if ( Simulation_impl::getSimulation()->direct_interthread ) {
             threadSync = new ThreadSyncDirectSkip(num_ranks.thread, rank.thread, Simulation_impl::getSimulation());
         }
         else {
+            if ( sim->thread_sync_neighbor && rank.rank == 0 && rank.thread == 0 ) {
+                sim->getSimulationOutput().output(
+                    "WARNING: --thread-sync-neighbor is only used with a single rank, using the regular thread "
+                    "sync\n");
+            }
             threadSync = new ThreadSyncSimpleSkip(num_ranks.thread, rank.thread, Simulation_impl::getSimulation());
         }
     }
@@ -328,7 +371,8 @@ SyncManager::execute(void)
 
     if ( profile_tools ) profile_tools->syncManagerStart();
 
-    switch ( next_sync_type ) {
+    sync_type_t sync_type = next_sync_type;
+    switch ( sync_type ) {
     case RANK:
         // Need to make sure all threads have reached the sync to
         // guarantee that all events have been sent to the appropriate
@@ -355,11 +399,17 @@ SyncManager::execute(void)
 
         RankExecBarrier[3].wait();
 
-        if ( exit != nullptr && rank.thread == 0 ) exit->check();
+        if ( exit != nullptr && rank.thread == 0 ) rankSync->checkExit(exit);
 
         RankExecBarrier[4].wait();
 
-        if ( exit->getGlobalCount() == 0 ) { endSimulation(exit->getEndTime()); }
+        // With the neighbor rank sync, the ranks find out the
+        // simulation is over at different times, so a rank that is
+        // behind the end time keeps going until it gets there
+        if ( exit->getGlobalCount() == 0 &&
+             (!rank_sync_neighbor || sim->getCurrentSimCycle() >= exit->getEndTime()) ) {
+            endSimulation(exit->getEndTime());
+        }
 
         break;
     case THREAD:
@@ -367,7 +417,13 @@ SyncManager::execute(void)
         threadSync->execute();
 
         if ( /*num_ranks.rank == 1*/ min_part == MAX_SIMTIME_T ) {
-            if ( exit->getRefCount() == 0 ) { endSimulation(exit->getEndTime()); }
+            // With the neighbor sync, the last primary component may
+            // have finished on a thread that is ahead of this one, so
+            // keep going until the end time (see computeNextInsert())
+            if ( exit->getRefCount() == 0 &&
+                 (!thread_sync_neighbor || sim->getCurrentSimCycle() >= exit->getEndTime()) ) {
+                endSimulation(exit->getEndTime());
+            }
         }
 
         break;
@@ -375,7 +431,9 @@ SyncManager::execute(void)
         break;
     }
     computeNextInsert();
-    RankExecBarrier[5].wait();
+    // The neighbor thread sync only waits on the threads it is
+    // linked to, so don't hold all of them together here
+    if ( sync_type == RANK || !thread_sync_neighbor ) RankExecBarrier[5].wait();
 
     if ( profile_tools ) profile_tools->syncManagerEnd();
 
@@ -415,6 +473,12 @@ SyncManager::prepareForComplete()
     if ( rank.thread == 0 ) rankSync->prepareForComplete();
 }
 
+void
+SyncManager::simulationEnded()
+{
+    threadSync->simulationEnded();
+}
+
 void
 SyncManager::computeNextInsert()
 {
@@ -424,7 +488,14 @@ SyncManager::computeNextInsert()
     }
     else {
         next_sync_type = THREAD;
-        sim->insertActivity(threadSync->getNextSyncTime(), this);
+        SimTime_t next = threadSync->getNextSyncTime();
+        // A thread that is behind when the primary components are all
+        // done needs a sync at the end time to stop there
+        if ( thread_sync_neighbor && exit->getRefCount() == 0 && exit->getEndTime() > sim->getCurrentSimCycle() &&
+             exit->getEndTime() < next ) {
+            next = exit->getEndTime();
+        }
+        sim->insertActivity(next, this);
     }
 }
 
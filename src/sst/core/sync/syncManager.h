@@ -52,6 +52,13 @@ public:
 
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
 
+    /**
+       Check whether all the primary components on all ranks are done.
+       Called on thread 0 after every rank sync.  The default is a
+       collective check across all ranks.
+    */
+    virtual void checkExit(Exit* exit);
+
     // void setMaxPeriod(TimeConverter* period) {max_period = period;}
     TimeConverter* getMaxPeriod() { return max_period; }
 
@@ -70,6 +77,9 @@ protected:
 
     void sendUntimedData_sync(Link* link, Event* data) { link->sendUntimedData_sync(data); }
 
+    /** Latency added to events sent to the remote rank on a link registered with the sync */
+    inline SimTime_t getSendLatency(Link* link) { return link->pair_link->latency; }
+
     inline void setLinkDeliveryInfo(Link* link, uintptr_t info) { link->pair_link->setDeliveryInfo(info); }
 
     inline Link* getDeliveryLink(Event* ev) { return ev->getDeliveryLink(); }
@@ -90,6 +100,9 @@ public:
     virtual void finalizeLinkConfigurations() = 0;
     virtual void prepareForComplete()         = 0;
 
+    /** Called by the owning thread when it ends the simulation */
+    virtual void simulationEnded() {}
+
     virtual SimTime_t getNextSyncTime() { return nextSyncTime; }
 
     void           setMaxPeriod(TimeConverter* period) { max_period = period; }
@@ -135,6 +148,8 @@ public:
     /** Finish link configuration */
     void finalizeLinkConfigurations();
     void prepareForComplete();
+    /** Called by the owning thread when it ends the simulation */
+    void simulationEnded();
 
     void print(const std::string& header, Output& out) const override;
 
@@ -160,6 +175,10 @@ private:
 
     sync_type_t next_sync_type;
     SimTime_t   min_part;
+    // Whether the RankSync only syncs with neighboring ranks
+    bool        rank_sync_neighbor;
+    // Whether the ThreadSync only syncs with neighboring threads
+    bool        thread_sync_neighbor;
 
     SyncProfileToolList* profile_tools = nullptr;
 
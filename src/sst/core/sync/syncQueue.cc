@@ -17,6 +17,9 @@
 #include "sst/core/serialization/serializer.h"
 #include "sst/core/simulation_impl.h"
 
+#include <cstring>
+#include <utility>
+
 #if SST_EVENT_PROFILING
 #define SST_EVENT_PROFILE_SIZE(events, bytes)                    \
     do {                                                         \
@@ -32,29 +35,79 @@ namespace SST {
 using namespace Core::ThreadSafe;
 using namespace Core::Serialization;
 
-SyncQueue::SyncQueue() : ActivityQueue(), buffer(nullptr), buf_size(0) {}
+SyncQueue::SyncQueue() :
+    ActivityQueue(),
+    buffer(nullptr),
+    buf_size(0),
+    data_size(sizeof(SyncQueue::Header) + sizeof(size_t)),
+    num_activities(0),
+    min_delivery_time(MAX_SIMTIME_T),
+    spare(nullptr),
+    spare_size(0)
+{
+    reserve(4096);
+}
 
-SyncQueue::~SyncQueue() {}
+SyncQueue::~SyncQueue()
+{
+    delete[] buffer;
+    delete[] spare;
+}
 
 bool
 SyncQueue::empty()
 {
     std::lock_guard<Spinlock> lock(slock);
-    return activities.empty();
+    return num_activities == 0;
 }
 
 int
 SyncQueue::size()
 {
     std::lock_guard<Spinlock> lock(slock);
-    return activities.size();
+    return num_activities;
 }
 
 void
 SyncQueue::insert(Activity* activity)
 {
-    std::lock_guard<Spinlock> lock(slock);
-    activities.push_back(activity);
+    // Size outside the lock so that only the copy into the buffer is
+    // serialized between threads
+    serializer ser;
+    ser.start_sizing();
+    ser& activity;
+    size_t size = ser.size();
+
+    {
+        std::lock_guard<Spinlock> lock(slock);
+        reserve(data_size + size);
+        pack(activity, size);
+    }
+    delete activity;
+}
+
+void
+SyncQueue::insertBatch(Activity* const* batch, size_t count)
+{
+    std::vector<size_t> sizes(count);
+    size_t              total = 0;
+    for ( size_t i = 0; i < count; ++i ) {
+        serializer ser;
+        ser.start_sizing();
+        Activity* activity = batch[i];
+        ser&      activity;
+        sizes[i] = ser.size();
+        total += sizes[i];
+    }
+
+    {
+        std::lock_guard<Spinlock> lock(slock);
+        reserve(data_size + total);
+        for ( size_t i = 0; i < count; ++i )
+            pack(batch[i], sizes[i]);
+    }
+    for ( size_t i = 0; i < count; ++i )
+        delete batch[i];
 }
 
 Activity*
@@ -80,7 +133,9 @@ void
 SyncQueue::clear()
 {
     std::lock_guard<Spinlock> lock(slock);
-    activities.clear();
+    data_size         = sizeof(SyncQueue::Header) + sizeof(size_t);
+    num_activities    = 0;
+    min_delivery_time = MAX_SIMTIME_T;
 }
 
 char*
@@ -88,37 +143,68 @@ SyncQueue::getData()
 {
     std::lock_guard<Spinlock> lock(slock);
 
-    serializer ser;
+    SST_EVENT_PROFILE_SIZE(num_activities, data_size - sizeof(SyncQueue::Header))
 
-    ser.start_sizing();
+    // The events are already packed, just need to fill in the count
+    // that the vector<Activity*> deserializer expects at the front
+    // and the size field in the header
+    memcpy(buffer + sizeof(SyncQueue::Header), &num_activities, sizeof(size_t));
+    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = data_size;
 
-    ser& activities;
+    return buffer;
+}
 
-    size_t size = ser.size();
+char*
+SyncQueue::swapData(SimTime_t& min_time)
+{
+    std::lock_guard<Spinlock> lock(slock);
 
-    SST_EVENT_PROFILE_SIZE(activities.size(), size)
+    SST_EVENT_PROFILE_SIZE(num_activities, data_size - sizeof(SyncQueue::Header))
 
-    if ( buf_size < (size + sizeof(SyncQueue::Header)) ) {
-        if ( buffer != nullptr ) { delete[] buffer; }
+    memcpy(buffer + sizeof(SyncQueue::Header), &num_activities, sizeof(size_t));
+    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = data_size;
+    min_time                                                                 = min_delivery_time;
 
-        buf_size = size + sizeof(SyncQueue::Header);
-        buffer   = new char[buf_size];
-    }
+    char* ret = buffer;
+    std::swap(buffer, spare);
+    std::swap(buf_size, spare_size);
+    if ( buffer == nullptr ) reserve(spare_size);
 
-    ser.start_packing(buffer + sizeof(SyncQueue::Header), size);
+    data_size         = sizeof(SyncQueue::Header) + sizeof(size_t);
+    num_activities    = 0;
+    min_delivery_time = MAX_SIMTIME_T;
+    return ret;
+}
 
-    ser& activities;
+void
+SyncQueue::pack(Activity* activity, size_t size)
+{
+    serializer ser;
+    ser.start_packing(buffer + data_size, size);
+    ser& activity;
+    if ( activity->getDeliveryTime() < min_delivery_time ) min_delivery_time = activity->getDeliveryTime();
+    data_size += size;
+    num_activities++;
+}
 
-    // Delete all the events
-    for ( unsigned int i = 0; i < activities.size(); i++ ) {
-        delete activities[i];
+void
+SyncQueue::reserve(size_t size)
+{
+    if ( size <= buf_size ) return;
+
+    // Grow geometrically so that a queue that fills up over a sync
+    // period only reallocates a handful of times.  The buffer is
+    // reused by later syncs, so it settles at the high water mark.
+    size_t new_size = buf_size * 2;
+    if ( new_size < size ) new_size = size;
+
+    char* new_buffer = new char[new_size];
+    if ( buffer != nullptr ) {
+        memcpy(new_buffer, buffer, data_size);
+        delete[] buffer;
     }
-    activities.clear();
-
-    // Set the size field in the header
-    static_cast<SyncQueue::Header*>(static_cast<void*>(buffer))->buffer_size = size + sizeof(SyncQueue::Header);
-
-    return buffer;
+    buffer   = new_buffer;
+    buf_size = new_size;
 }
 
 } // namespace SST
@@ -13,6 +13,7 @@
 #define SST_CORE_SYNC_SYNCQUEUE_H
 
 #include "sst/core/activityQueue.h"
+#include "sst/core/sst_types.h"
 #include "sst/core/threadsafe.h"
 
 #include <vector>
@@ -24,16 +25,25 @@ namespace SST {
  *
  * Internal API
  *
- * Activity Queue for use by Sync Objects
+ * Activity Queue for use by Sync Objects.  Activities are serialized
+ * into the send buffer as they are inserted, so at the sync point the
+ * buffer is already packed and getData() only has to fill in the
+ * header.  The buffer is kept between syncs and only grows.
+ *
+ * For syncs that overlap the exchange with execution, swapData()
+ * hands off the packed buffer and switches inserts to a second
+ * buffer, so the first can stay in flight until the next sync.
  */
 class SyncQueue : public ActivityQueue
 {
 public:
     struct Header
     {
-        uint32_t mode;
-        uint32_t count;
-        uint32_t buffer_size;
+        uint32_t  mode;
+        uint32_t  count;
+        uint32_t  buffer_size;
+        // Only used by syncs that track time per neighbor
+        SimTime_t time;
     };
 
     SyncQueue();
@@ -42,6 +52,7 @@ public:
     bool      empty() override;
     int       size() override;
     void      insert(Activity* activity) override;
+    void      insertBatch(Activity* const* batch, size_t count) override;
     Activity* pop() override; // Not a good idea for this particular class
     Activity* front() override;
 
@@ -50,13 +61,37 @@ public:
     void  clear();
     /** Accessor method to the internal queue */
     char* getData();
+    /**
+       Finish the current buffer like getData(), then start packing
+       into the other buffer.  The returned buffer is valid until the
+       next call to swapData().
+
+       @param min_time Set to the earliest delivery time of the
+       activities in the returned buffer, or MAX_SIMTIME_T if it is
+       empty
+     */
+    char* swapData(SimTime_t& min_time);
 
-    uint64_t getDataSize() { return buf_size + (activities.capacity() * sizeof(Activity*)); }
+    uint64_t getDataSize() { return buf_size + spare_size; }
 
 private:
-    char*                  buffer;
-    size_t                 buf_size;
-    std::vector<Activity*> activities;
+    /** Serialize an activity of the given packed size onto the end of the buffer */
+    void pack(Activity* activity, size_t size);
+
+    /** Make sure the buffer can hold at least size bytes */
+    void reserve(size_t size);
+
+    char*  buffer;
+    size_t buf_size;
+    // Bytes of the buffer in use, including the header and count
+    size_t data_size;
+    size_t num_activities;
+    // Earliest delivery time in the buffer, only used by swapData()
+    SimTime_t min_delivery_time;
+
+    // Buffer in flight when using swapData()
+    char*  spare;
+    size_t spare_size;
 
     Core::ThreadSafe::Spinlock slock;
 };
@@ -0,0 +1,271 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "sst/core/sync/threadSyncNeighborSkip.h"
+
+#include "sst/core/event.h"
+#include "sst/core/interprocess/sstmutex.h"
+#include "sst/core/link.h"
+#include "sst/core/profile.h"
+#include "sst/core/simulation_impl.h"
+#include "sst/core/timeVortex.h"
+
+namespace SST {
+
+std::vector<ThreadSyncNeighborSkip::Channel*> ThreadSyncNeighborSkip::channels;
+
+/** Create a new ThreadSyncNeighborSkip object */
+ThreadSyncNeighborSkip::ThreadSyncNeighborSkip(
+    int num_threads, int thread, Simulation_impl* sim, const std::vector<SimTime_t>& interThreadLatencies) :
+    ThreadSync(),
+    in(num_threads, nullptr),
+    interThreadLatencies(interThreadLatencies),
+    num_threads(num_threads),
+    thread(thread),
+    sim(sim),
+    totalWaitTime(0.0)
+{
+    // The channels are filled in as the links are registered, which
+    // happens one thread at a time
+    if ( thread == 0 ) { channels.resize(num_threads * num_threads, nullptr); }
+
+    my_max_period = sim->getInterThreadMinLatency();
+
+    // Nothing can arrive from a neighbor before its lookahead, so
+    // that is as far as we can go before the first sync
+    nextSyncTime = MAX_SIMTIME_T;
+    for ( int i = 0; i < num_threads; i++ ) {
+        if ( i == thread || interThreadLatencies[i] == MAX_SIMTIME_T ) continue;
+        SimTime_t lookahead = interThreadLatencies[i] > 0 ? interThreadLatencies[i] : 1;
+        if ( lookahead < nextSyncTime ) nextSyncTime = lookahead;
+    }
+    if ( nextSyncTime == MAX_SIMTIME_T ) nextSyncTime = my_max_period;
+}
+
+ThreadSyncNeighborSkip::~ThreadSyncNeighborSkip()
+{
+    if ( totalWaitTime > 0.0 )
+        Output::getDefaultObject().verbose(
+            CALL_INFO, 1, 0, "ThreadSyncNeighborSkip total wait time: %lg seconds.\n", totalWaitTime);
+    // We own the channels we receive from
+    for ( auto i : neighbors ) {
+        delete in[i];
+    }
+    in.clear();
+}
+
+void
+ThreadSyncNeighborSkip::registerLink(const std::string& name, Link* link)
+{
+    auto iter = link_map.find(name);
+    if ( iter == link_map.end() ) {
+        // I have initialized first, so just put the name and link in
+        // the map
+        link_map[name] = link;
+    }
+    else {
+        // I already have the remote info, so initialize the link data
+        Link* remote_link = iter->second;
+        setLinkDeliveryInfo(link, reinterpret_cast<uintptr_t>(remote_link));
+        link_map.erase(iter);
+    }
+}
+
+ActivityQueue*
+ThreadSyncNeighborSkip::registerRemoteLink(int tid, const std::string& name, Link* link)
+{
+    auto iter = link_map.find(name);
+    if ( iter == link_map.end() ) {
+        // I have initialized first, so just put the name and link in
+        // the map
+        link_map[name] = link;
+    }
+    else {
+        // I already have the local info, so initialize the link data
+        Link* local_link = iter->second;
+        setLinkDeliveryInfo(local_link, reinterpret_cast<uintptr_t>(link));
+        link_map.erase(iter);
+    }
+
+    if ( in[tid] == nullptr ) {
+        SimTime_t lookahead = interThreadLatencies[tid] > 0 ? interThreadLatencies[tid] : 1;
+        in[tid]             = new Channel(lookahead);
+        channels[thread * num_threads + tid] = in[tid];
+        neighbors.push_back(tid);
+    }
+    return in[tid];
+}
+
+void
+ThreadSyncNeighborSkip::deliver()
+{
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+    // Empty the channels and send the events on the links
+    for ( auto i : neighbors ) {
+        Channel*  channel = in[i];
+        Activity* act;
+        while ( (act = channel->pop()) != nullptr ) {
+            Event*    ev    = static_cast<Event*>(act);
+            SimTime_t delay = ev->getDeliveryTime() - current_cycle;
+            getDeliveryLink(ev)->send(delay, ev);
+        }
+    }
+}
+
+void
+ThreadSyncNeighborSkip::publish(SimTime_t time)
+{
+    // Release makes the events we sent before this visible to any
+    // neighbor that sees the new time
+    for ( auto channel : out ) {
+        channel->time.store(time, std::memory_order_release);
+    }
+}
+
+void
+ThreadSyncNeighborSkip::before()
+{
+    deliver();
+}
+
+void
+ThreadSyncNeighborSkip::after()
+{
+    // Only get here for a rank sync, where all the threads sync
+    // together, so just publish the time and check back within the
+    // lookahead
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+    publish(current_cycle);
+    nextSyncTime = current_cycle + my_max_period;
+}
+
+void
+ThreadSyncNeighborSkip::execute()
+{
+    SimTime_t current_cycle = sim->getCurrentSimCycle();
+
+    // We have finished everything before now, so nothing else we send
+    // can be earlier than now
+    publish(current_cycle);
+
+    // Wait until every neighbor has gone far enough that nothing more
+    // can arrive from it at the current time.  A neighbor that has
+    // ended the simulation won't publish again and won't send
+    // anything else, so stop waiting on it.
+    Core::Interprocess::SSTMutex backoff;
+    int                          loop_counter = 0;
+    SimTime_t                    horizon;
+    auto                         waitStart = SST::Core::Profile::now();
+    while ( true ) {
+        horizon = MAX_SIMTIME_T;
+        for ( auto i : neighbors ) {
+            Channel*  channel = in[i];
+            SimTime_t limit   = channel->time.load(std::memory_order_acquire) + channel->lookahead;
+            if ( limit > current_cycle ) {
+                if ( limit < horizon ) horizon = limit;
+            }
+            else if ( !channel->ended.load(std::memory_order_acquire) ) {
+                horizon = current_cycle;
+                break;
+            }
+        }
+        if ( horizon > current_cycle || sim->endSim ) break;
+        backoff.processorPause(loop_counter++);
+    }
+    if ( loop_counter > 0 ) totalWaitTime += SST::Core::Profile::getElapsed(waitStart);
+
+    deliver();
+
+    // Everything that can arrive before the horizon is now in our
+    // TimeVortex, so we won't send anything before the earlier of
+    // our next activity and the horizon.  Publishing that lets the
+    // neighbors skip ahead over any time we are idle.
+    TimeVortex* tv   = sim->getTimeVortex();
+    SimTime_t   next = horizon;
+    if ( !tv->empty() && tv->front()->getDeliveryTime() < next ) next = tv->front()->getDeliveryTime();
+    if ( next == MAX_SIMTIME_T ) next = current_cycle;
+    if ( next > current_cycle ) publish(next);
+
+    // Check back within our lookahead so the neighbors see our
+    // progress, even if nothing limits how far we could go
+    SimTime_t period = next + my_max_period;
+    nextSyncTime     = horizon < period ? horizon : period;
+}
+
+void
+ThreadSyncNeighborSkip::simulationEnded()
+{
+    // The neighbors may be waiting for us to publish a later time,
+    // which won't happen now
+    for ( auto channel : out ) {
+        channel->ended.store(true, std::memory_order_release);
+    }
+}
+
+void
+ThreadSyncNeighborSkip::processLinkUntimedData()
+{
+    // Need to walk through all the channels and send the data to the
+    // correct links
+    for ( auto i : neighbors ) {
+        Channel*  channel = in[i];
+        Activity* act;
+        while ( (act = channel->pop()) != nullptr ) {
+            Event* ev = static_cast<Event*>(act);
+            sendUntimedData_sync(getDeliveryLink(ev), ev);
+        }
+    }
+}
+
+void
+ThreadSyncNeighborSkip::finalizeLinkConfigurations()
+{
+    for ( auto i = link_map.begin(); i != link_map.end(); ++i ) {
+        finalizeConfiguration(i->second);
+    }
+
+    // All the links have been registered, so find the channels we
+    // send on
+    for ( int i = 0; i < num_threads; i++ ) {
+        Channel* channel = channels[i * num_threads + thread];
+        if ( channel != nullptr ) out.push_back(channel);
+    }
+}
+
+void
+ThreadSyncNeighborSkip::prepareForComplete()
+{
+    for ( auto i = link_map.begin(); i != link_map.end(); ++i ) {
+        prepareForCompleteInt(i->second);
+    }
+
+    // Threads stop at different times, so there may still be events
+    // from past the end of the run.  All the threads have stopped by
+    // now, so throw them away before the complete() data starts.
+    for ( auto i : neighbors ) {
+        Channel*  channel = in[i];
+        Activity* act;
+        while ( (act = channel->pop()) != nullptr ) {
+            delete act;
+        }
+    }
+}
+
+uint64_t
+ThreadSyncNeighborSkip::getDataSize() const
+{
+    size_t count = 0;
+    return count;
+}
+
+} // namespace SST
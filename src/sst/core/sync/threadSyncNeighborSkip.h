@@ -0,0 +1,135 @@
+// Copyright 2009-2022 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2022, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef SST_CORE_SYNC_THREADSYNCNEIGHBORSKIP_H
+#define SST_CORE_SYNC_THREADSYNCNEIGHBORSKIP_H
+
+#include "sst/core/activityQueue.h"
+#include "sst/core/sst_types.h"
+#include "sst/core/sync/syncManager.h"
+#include "sst/core/threadsafe.h"
+
+#include <atomic>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+
+class Link;
+class Simulation_impl;
+
+/**
+ * ThreadSync that only synchronizes each thread with the threads it
+ * shares links with, using the minimum latency of the links from each
+ * of them as the lookahead for that neighbor.
+ *
+ * Every pair of neighboring threads has a channel in each direction:
+ * a lock-free single producer, single consumer queue for the events
+ * and the time the sending thread has published.  A thread promises
+ * not to send anything before its published time, so nothing can
+ * arrive from neighbor j before j's published time plus the latency
+ * from j.  At a sync a thread publishes its time, waits only until
+ * every neighbor has published far enough to let it move past the
+ * current time, then delivers the events in its channels.  A slow
+ * thread only stalls the threads it is linked to, not all of them.
+ *
+ * Threads don't share a sync schedule, so this is only used when
+ * there is a single rank.
+ */
+class ThreadSyncNeighborSkip : public ThreadSync
+{
+public:
+    /** Create a new ThreadSync object */
+    ThreadSyncNeighborSkip(
+        int num_threads, int thread, Simulation_impl* sim, const std::vector<SimTime_t>& interThreadLatencies);
+    ~ThreadSyncNeighborSkip();
+
+    void before() override;
+    void after() override;
+    void execute(void) override;
+
+    /** Cause an exchange of Untimed Data to occur */
+    void processLinkUntimedData() override;
+    /** Finish link configuration */
+    void finalizeLinkConfigurations() override;
+    void prepareForComplete() override;
+    void simulationEnded() override;
+
+    /** Register a Link which this Sync Object is responsible for */
+    void           registerLink(const std::string& name, Link* link) override;
+    ActivityQueue* registerRemoteLink(int tid, const std::string& name, Link* link) override;
+
+    uint64_t getDataSize() const;
+
+private:
+    /** Events and published time from one thread to another */
+    class Channel : public ActivityQueue, public Core::ThreadSafe::CacheAlignedNew
+    {
+    public:
+        Channel(SimTime_t lookahead) : lookahead(lookahead), time(0), ended(false) {}
+
+        bool      empty() override { return queue.empty(); }
+        int       size() override { return 0; }
+        Activity* pop() override
+        {
+            Activity* act = nullptr;
+            queue.try_remove(act);
+            return act;
+        }
+        void      insert(Activity* activity) override { queue.insert(activity); }
+        Activity* front() override { return nullptr; }
+
+        // Minimum latency of the links on the channel
+        const SimTime_t lookahead;
+        // Time published by the sending thread
+        CACHE_ALIGNED(std::atomic<SimTime_t>, time);
+        // Set once the sending thread has ended the simulation
+        std::atomic<bool> ended;
+
+    private:
+        Core::ThreadSafe::SPSCQueue<Activity*> queue;
+    };
+
+    /** Send the events waiting in the channels on to their links */
+    void deliver();
+
+    /** Publish our time to the neighbors */
+    void publish(SimTime_t time);
+
+    // Stores the links until they can be intialized with the right
+    // remote data.  It will hold whichever thread registers the link
+    // first and will be removed after the second thread registers and
+    // the link is properly initialized with the remote data.
+    std::unordered_map<std::string, Link*> link_map;
+
+    // Channels from the neighbors (indexed by their thread), nullptr
+    // for threads that aren't neighbors
+    std::vector<Channel*> in;
+    // Threads we receive from
+    std::vector<int>      neighbors;
+    // Channels to the threads we send to, found in
+    // finalizeLinkConfigurations()
+    std::vector<Channel*> out;
+
+    // All channels, indexed by [to * num_threads + from]
+    static std::vector<Channel*> channels;
+
+    const std::vector<SimTime_t> interThreadLatencies;
+    SimTime_t                    my_max_period;
+    int                          num_threads;
+    int                          thread;
+    Simulation_impl*             sim;
+    double                       totalWaitTime;
+};
+
+} // namespace SST
+
+#endif // SST_CORE_SYNC_THREADSYNCNEIGHBORSKIP_H
@@ -36,9 +36,10 @@ ThreadSyncSimpleSkip::ThreadSyncSimpleSkip(int num_threads, int thread, Simulati
     }
 
     if ( sim->getRank().thread == 0 ) {
-        barrier[0].resize(num_threads);
-        barrier[1].resize(num_threads);
-        barrier[2].resize(num_threads);
+        for ( auto& b : barrier ) {
+            b.resize(num_threads);
+            b.setHybrid(sim->hybrid_barriers);
+        }
     }
 
     if ( sim->getNumRanks().rank > 1 )
@@ -37,6 +37,9 @@ coreTestLinks::coreTestLinks(ComponentId_t id, Params& params) : Component(id),
     UnitAlgebra link_tb  = params.find<UnitAlgebra>("link_time_base", "1ns");
     UnitAlgebra send_lat = params.find<UnitAlgebra>("added_send_latency", found_sendlat);
     UnitAlgebra recv_lat = params.find<UnitAlgebra>("added_recv_latency", found_recvlat);
+    send_batch           = params.find<bool>("send_batch", false);
+    link_tb_ns           = (link_tb / UnitAlgebra("1ns")).getRoundedValue();
+    ns_tc                = getTimeConverter("1ns");
 
     // configure out links
     E = configureLink(
@@ -57,7 +60,7 @@ coreTestLinks::coreTestLinks(ComponentId_t id, Params& params) : Component(id),
     }
 
     // set our clock
-    registerClock("100 MHz", new Clock::Handler<coreTestLinks>(this, &coreTestLinks::clockTic));
+    clock_tc = registerClock("100 MHz", new Clock::Handler<coreTestLinks>(this, &coreTestLinks::clockTic));
 }
 
 coreTestLinks::~coreTestLinks() {}
@@ -79,6 +82,21 @@ coreTestLinks::clockTic(Cycle_t cycle)
     // Each clock cycle, send with increasing addtional latency, for 4 cycles, end of 5th
     if ( cycle == 5 ) { return true; }
 
+    if ( send_batch ) {
+        // Send everything on the first cycle, with delays that
+        // deliver each event at the same time it would have been
+        // delivered if sent on its own cycle
+        if ( cycle != 1 ) return false;
+        SimTime_t delays[4];
+        Event*    events[4] = { nullptr, nullptr, nullptr, nullptr };
+        SimTime_t period    = clock_tc->getFactor() / ns_tc->getFactor(); // ns
+        for ( int i = 0; i < 4; ++i )
+            delays[i] = period * i + (i + 1) * link_tb_ns;
+        E->sendBatch(4, events, delays, ns_tc);
+        W->sendBatch(4, events, delays, ns_tc);
+        return false;
+    }
+
     E->send(cycle, nullptr);
     W->send(cycle, nullptr);
 
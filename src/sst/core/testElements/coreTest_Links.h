@@ -40,7 +40,8 @@ public:
         { "id",                 "ID of component", "" },
         { "added_send_latency", "Additional output latency to add to sends", "0ns"},
         { "added_recv_latency", "Additional input latency to add to incoming events", "0ns"},
-        { "link_time_base",     "Timebase for links", "1ns" }
+        { "link_time_base",     "Timebase for links", "1ns" },
+        { "send_batch",         "Send all the events with Link::sendBatch() on the first cycle instead of one per cycle", "false" }
     )
 
     // Optional since there is nothing to document
@@ -62,14 +63,18 @@ public:
     void finish() {}
 
 private:
-    int my_id;
-    int recv_count;
+    int     my_id;
+    int     recv_count;
+    bool    send_batch;
+    int64_t link_tb_ns;
 
     void         handleEvent(SST::Event* ev, std::string from);
     virtual bool clockTic(SST::Cycle_t);
 
-    SST::Link* E;
-    SST::Link* W;
+    SST::Link*          E;
+    SST::Link*          W;
+    SST::TimeConverter* ns_tc;
+    SST::TimeConverter* clock_tc;
 };
 
 } // namespace CoreTestComponent
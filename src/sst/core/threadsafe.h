@@ -22,8 +22,11 @@
 #endif
 
 #include <atomic>
+#include <climits>
 #include <condition_variable>
+#include <cstdlib>
 #include <mutex>
+#include <new>
 #include <thread>
 #include <vector>
 //#include <stdalign.h>
@@ -31,6 +34,11 @@
 #include "sst/core/profile.h"
 
 #include <time.h>
+#ifdef __linux__
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
 
 namespace SST {
 namespace Core {
@@ -50,11 +58,103 @@ class CACHE_ALIGNED_T Barrier
     std::atomic<bool>   enabled;
     std::atomic<size_t> count, generation;
 
+    // Hybrid mode: spin for an adaptive, bounded number of pauses,
+    // then sleep until the barrier is released
+    bool                  hybrid;
+    std::atomic<uint32_t> spin_limit;
+    std::atomic<uint32_t> sleepers;
+    // Futex word, bumped when sleepers need to be woken
+    std::atomic<uint32_t> wake_seq;
+
+    static const uint32_t MIN_SPIN = 128;
+    static const uint32_t MAX_SPIN = 1 << 16;
+
+    // Number of hybrid waits released while spinning and while
+    // sleeping, for all barriers
+    static std::atomic<uint64_t>& spinWaits()
+    {
+        static std::atomic<uint64_t> waits(0);
+        return waits;
+    }
+
+    static std::atomic<uint64_t>& sleepWaits()
+    {
+        static std::atomic<uint64_t> waits(0);
+        return waits;
+    }
+
+    void waitHybrid(size_t gen)
+    {
+        uint32_t limit = spin_limit.load(std::memory_order_relaxed);
+        for ( uint32_t i = 0; i < limit; i++ ) {
+            if ( gen != generation.load(std::memory_order_acquire) ) {
+                // If most of the spin was needed, allow more next time
+                if ( i > limit / 2 && limit < MAX_SPIN ) spin_limit.store(limit * 2, std::memory_order_relaxed);
+                spinWaits().fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            sst_pause();
+        }
+
+        // Spinning didn't pay off, so spin less next time
+        if ( limit > MIN_SPIN ) spin_limit.store(limit / 2, std::memory_order_relaxed);
+        sleepWaits().fetch_add(1, std::memory_order_relaxed);
+
+        while ( gen == generation.load(std::memory_order_acquire) ) {
+#ifdef __linux__
+            // Read the futex word before announcing ourselves, so a
+            // wake that happens after the generation check below
+            // makes the futex wait return right away
+            uint32_t seq = wake_seq.load();
+            sleepers.fetch_add(1);
+            if ( gen == generation.load() ) {
+                syscall(
+                    SYS_futex, reinterpret_cast<uint32_t*>(&wake_seq), FUTEX_WAIT_PRIVATE, seq, nullptr, nullptr, 0);
+            }
+            sleepers.fetch_sub(1);
+#else
+            struct timespec ts;
+            ts.tv_sec  = 0;
+            ts.tv_nsec = 1000;
+            nanosleep(&ts, nullptr);
+#endif
+        }
+    }
+
+    void wakeSleepers()
+    {
+#ifdef __linux__
+        if ( sleepers.load() > 0 ) {
+            wake_seq.fetch_add(1);
+            syscall(
+                SYS_futex, reinterpret_cast<uint32_t*>(&wake_seq), FUTEX_WAKE_PRIVATE, INT_MAX, nullptr, nullptr, 0);
+        }
+#endif
+    }
+
 public:
-    Barrier(size_t count) : origCount(count), enabled(true), count(count), generation(0) {}
+    Barrier(size_t count) :
+        origCount(count),
+        enabled(true),
+        count(count),
+        generation(0),
+        hybrid(false),
+        spin_limit(MIN_SPIN),
+        sleepers(0),
+        wake_seq(0)
+    {}
 
     // Come g++ 4.7, this can become a delegating constructor
-    Barrier() : origCount(0), enabled(false), count(0), generation(0) {}
+    Barrier() :
+        origCount(0),
+        enabled(false),
+        count(0),
+        generation(0),
+        hybrid(false),
+        spin_limit(MIN_SPIN),
+        sleepers(0),
+        wake_seq(0)
+    {}
 
     /** ONLY call this while nobody is in wait() */
     void resize(size_t newCount)
@@ -64,6 +164,22 @@ public:
         enabled.store(true);
     }
 
+    /**
+     * Select how waiting threads wait.  By default they spin, then
+     * yield, then poll with short sleeps.  In hybrid mode they spin
+     * for a bounded time that adapts to how long recent waits took,
+     * then sleep until the barrier is released, which keeps
+     * oversubscribed threads from starving the ones still working.
+     * ONLY call this while nobody is in wait()
+     */
+    void setHybrid(bool enable) { hybrid = enable; }
+
+    /** Number of hybrid mode waits that were released while spinning */
+    static uint64_t getSpinWaitCount() { return spinWaits().load(); }
+
+    /** Number of hybrid mode waits that had to sleep */
+    static uint64_t getSleepWaitCount() { return sleepWaits().load(); }
+
     /**
      * Wait for all threads to reach this point.
      * @return 0.0, or elapsed time spent waiting, if configured with --enable-profile
@@ -84,6 +200,10 @@ public:
                 /* Incrementing generation causes release */
                 generation.fetch_add(1, std::memory_order_release);
                 __sync_synchronize();
+                if ( hybrid ) wakeSleepers();
+            }
+            else if ( hybrid ) {
+                waitHybrid(gen);
             }
             else {
                 /* Try spinning first */
@@ -112,6 +232,7 @@ public:
         enabled.store(false);
         count.store(0);
         ++generation;
+        if ( hybrid ) wakeSleepers();
     }
 };
 
@@ -314,6 +435,124 @@ public:
     }
 };
 
+/**
+ * Base for classes with CACHE_ALIGNED members that are allocated with
+ * new.  Before C++17, new only guarantees the alignment of the
+ * fundamental types, so this allocates cache aligned storage instead.
+ */
+class CacheAlignedNew
+{
+public:
+    static void* operator new(std::size_t size)
+    {
+        void* ptr = nullptr;
+        if ( posix_memalign(&ptr, 64, size) != 0 ) throw std::bad_alloc();
+        return ptr;
+    }
+
+    static void operator delete(void* ptr) { free(ptr); }
+};
+
+/**
+ * Unbounded single-producer/single-consumer queue.  Elements are
+ * stored in fixed size blocks, so neither insert nor remove needs a
+ * lock or an allocation per element.  The producer only writes the
+ * block it is filling and the published count; the consumer only
+ * reads them.  Blocks emptied by the consumer are handed back to the
+ * producer for reuse.
+ */
+template <typename T, size_t BLOCK_SIZE = 256>
+class SPSCQueue : public CacheAlignedNew
+{
+    struct Block
+    {
+        T                   data[BLOCK_SIZE];
+        std::atomic<Block*> next;
+
+        Block() : next(nullptr) {}
+    };
+
+    // Producer side
+    CACHE_ALIGNED(Block*, tail);
+    size_t tail_index;
+    size_t produced;
+
+    // Number of elements published to the consumer
+    CACHE_ALIGNED(std::atomic<size_t>, written);
+
+    // Consumer side
+    CACHE_ALIGNED(Block*, head);
+    size_t head_index;
+    size_t consumed;
+    size_t cached_written;
+
+    // One emptied block kept for reuse by the producer
+    CACHE_ALIGNED(std::atomic<Block*>, spare);
+
+public:
+    SPSCQueue() :
+        tail(new Block()),
+        tail_index(0),
+        produced(0),
+        written(0),
+        head(tail),
+        head_index(0),
+        consumed(0),
+        cached_written(0),
+        spare(nullptr)
+    {}
+
+    ~SPSCQueue()
+    {
+        while ( head != nullptr ) {
+            Block* tmp = head;
+            head       = tmp->next.load();
+            delete tmp;
+        }
+        delete spare.load();
+    }
+
+    /** Only safe to call from the producer */
+    void insert(const T& t)
+    {
+        if ( tail_index == BLOCK_SIZE ) {
+            Block* block = spare.exchange(nullptr, std::memory_order_acquire);
+            if ( block == nullptr )
+                block = new Block();
+            else
+                block->next.store(nullptr, std::memory_order_relaxed);
+            tail->next.store(block, std::memory_order_relaxed);
+            tail       = block;
+            tail_index = 0;
+        }
+        tail->data[tail_index++] = t;
+        written.store(++produced, std::memory_order_release);
+    }
+
+    /** Only safe to call from the consumer */
+    bool empty()
+    {
+        if ( consumed != cached_written ) return false;
+        cached_written = written.load(std::memory_order_acquire);
+        return consumed == cached_written;
+    }
+
+    /** Only safe to call from the consumer */
+    bool try_remove(T& result)
+    {
+        if ( empty() ) return false;
+        if ( head_index == BLOCK_SIZE ) {
+            Block* old = head;
+            head       = old->next.load(std::memory_order_relaxed);
+            head_index = 0;
+            delete spare.exchange(old, std::memory_order_release);
+        }
+        result = head->data[head_index++];
+        consumed++;
+        return true;
+    }
+};
+
 } // namespace ThreadSafe
 } // namespace Core
 } // namespace SST
@@ -18,4 +18,23 @@ namespace SST {
 SST_ELI_DEFINE_CTOR_EXTERN(TimeVortex)
 SST_ELI_DEFINE_INFO_EXTERN(TimeVortex)
 
+size_t
+TimeVortex::popBatch(std::vector<Activity*>& batch)
+{
+    Activity* head = pop();
+    if ( nullptr == head ) return 0;
+    batch.push_back(head);
+
+    size_t    count    = 1;
+    SimTime_t time     = head->getDeliveryTime();
+    int       priority = head->getPriority();
+    while ( !empty() ) {
+        Activity* next = front();
+        if ( next->getDeliveryTime() != time || next->getPriority() != priority ) break;
+        batch.push_back(pop());
+        count++;
+    }
+    return count;
+}
+
 } // namespace SST
@@ -15,6 +15,8 @@
 #include "sst/core/activityQueue.h"
 #include "sst/core/module.h"
 
+#include <vector>
+
 namespace SST {
 
 class Output;
@@ -39,6 +41,13 @@ public:
     virtual Activity* pop() override                      = 0;
     virtual Activity* front() override                    = 0;
 
+    /** Remove the activity at the head of the queue along with every
+     * other activity that has the same delivery time and priority,
+     * appending them to batch in the order pop() would return them.
+     * @return Number of activities appended to batch
+     */
+    virtual size_t popBatch(std::vector<Activity*>& batch);
+
     /** Print the state of the TimeVortex */
     virtual void     print(Output& out) const = 0;
     virtual uint64_t getMaxDepth() const { return max_depth; }
@@ -13,9 +13,11 @@ import sys
 
 dangling = False
 wrong_port = False
+send_batch = False
 if len(sys.argv) == 2:
     if sys.argv[1] == "dangling": dangling=True
     if sys.argv[1] == "wrong_port": wrong_port=True
+    if sys.argv[1] == "batch": send_batch=True
 
 # Define the simulation components
 comp_c0 = sst.Component("c1", "coreTestElement.coreTestLinks")
@@ -46,6 +48,10 @@ comp_c3.addParams({
     "link_time_base"     : "4 ns"
 })
 
+if send_batch:
+    for comp in [comp_c0, comp_c1, comp_c2, comp_c3]:
+        comp.addParam("send_batch", True)
+
 # Define the links
 link_0 = sst.Link("link_0")
 if not dangling:
@@ -18,6 +18,10 @@ sst.setProgramOption("stopAtCycle", "10us")
 
 x_size = int(sys.argv[1])
 y_size = int(sys.argv[2])
+# Optionally place the routers on a grid (coords) and give each router
+# a different link latency (latencies)
+use_coords = "coords" in sys.argv[3:]
+vary_latency = "latencies" in sys.argv[3:]
 
 # Calculate number of routers and endpoints
 num_routers = x_size * y_size
@@ -37,6 +41,13 @@ for i in range(num_routers):
 
     comp = sst.Component("component%d"%i, "coreTestElement.message_mesh.enclosing_component")
     comp.addParam("id",i)
+    if use_coords:
+        comp.setCoordinates(my_x, my_y)
+
+    # Latency of messages sent by this router
+    latency = "1ns"
+    if vary_latency:
+        latency = "%dps"%(1000 + (i * 37) % 1000)
     
     # Setup up all the ports.  X ports will use MessagePort directly, Y ports, will use the SlotPort
     port_x_pos = comp.setSubComponent("ports","coreTestElement.message_mesh.message_port",0);
@@ -59,7 +70,7 @@ for i in range(num_routers):
     their_x = my_x + 1
     if their_x == x_size:
         their_x = 0
-    port_x_pos.addLink(getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(their_x,my_y)), "port", "1ns")
+    port_x_pos.addLink(getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(their_x,my_y)), "port", latency)
     # Set the nocut attribute on positive x-link on every other router
     if ( i % 2 == 0):
         getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(their_x,my_y)).setNoCut()
@@ -68,7 +79,7 @@ for i in range(num_routers):
     their_x = my_x - 1
     if their_x == -1:
         their_x = x_size - 1
-    port_x_neg.addLink(getLink("x%dy%d"%(their_x,my_y), "x%dy%d"%(my_x,my_y)), "port", "1ns")
+    port_x_neg.addLink(getLink("x%dy%d"%(their_x,my_y), "x%dy%d"%(my_x,my_y)), "port", latency)
 
 
     # Y-dim
@@ -76,10 +87,10 @@ for i in range(num_routers):
     their_y = my_y + 1
     if their_y == y_size:
         their_y = 0
-    port_y_pos.addLink(getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(my_x,their_y)), "port", "1ns")
+    port_y_pos.addLink(getLink("x%dy%d"%(my_x,my_y), "x%dy%d"%(my_x,their_y)), "port", latency)
 
     # Negative
     their_y = my_y - 1
     if their_y == -1:
         their_y = y_size - 1
-    port_y_neg.addLink(getLink("x%dy%d"%(my_x,their_y), "x%dy%d"%(my_x,my_y)), "port", "1ns")
+    port_y_neg.addLink(getLink("x%dy%d"%(my_x,their_y), "x%dy%d"%(my_x,my_y)), "port", latency)
@@ -0,0 +1,75 @@
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+import sst
+
+# Primary components in different partitions finish at different
+# times.  gen1 has all of its messages by about 115 ns, but gen0
+# doesn't get the last of gen1's messages until 230 ns.  The clocker
+# prints on its own clocks until 225 ns, so its partition has to keep
+# running up to the end time even though its own primary components
+# are all done.
+#
+# On one rank, gen0 is on thread 0 and everything else on thread 1.
+# On more than one rank, the components make a chain of three ranks,
+# with gen2 and gen3 linking the last two.
+sst.setProgramOption("partitioner", "sst.self")
+
+if sst.getMPIRankCount() > 1:
+    middle = (1, 0)
+    last = (min(2, sst.getMPIRankCount() - 1), 0)
+else:
+    middle = (0, 1)
+    last = (0, 1)
+
+comp_gen0 = sst.Component("gen0", "coreTestElement.coreTestMessageGeneratorComponent")
+comp_gen0.addParams({
+      "outputinfo" : "1",
+      "sendcount" : "13",
+      "clock" : "1GHz"
+})
+comp_gen0.setRank(0, 0)
+
+comp_gen1 = sst.Component("gen1", "coreTestElement.coreTestMessageGeneratorComponent")
+comp_gen1.addParams({
+      "outputinfo" : "1",
+      "sendcount" : "13",
+      "clock" : "100MHz"
+})
+comp_gen1.setRank(*middle)
+
+comp_gen2 = sst.Component("gen2", "coreTestElement.coreTestMessageGeneratorComponent")
+comp_gen2.addParams({
+      "outputinfo" : "1",
+      "sendcount" : "10",
+      "clock" : "1GHz"
+})
+comp_gen2.setRank(*middle)
+
+comp_gen3 = sst.Component("gen3", "coreTestElement.coreTestMessageGeneratorComponent")
+comp_gen3.addParams({
+      "outputinfo" : "1",
+      "sendcount" : "10",
+      "clock" : "1GHz"
+})
+comp_gen3.setRank(*last)
+
+comp_clocker = sst.Component("clocker", "coreTestElement.coreTestClockerComponent")
+comp_clocker.addParams({
+      "clockcount" : "1",
+      "clock" : "1GHz"
+})
+comp_clocker.setRank(*last)
+
+link_gen = sst.Link("link_gen")
+link_gen.connect( (comp_gen0, "remoteComponent", "100ns"), (comp_gen1, "remoteComponent", "100ns") )
+
+link_gen2 = sst.Link("link_gen2")
+link_gen2.connect( (comp_gen2, "remoteComponent", "10ns"), (comp_gen3, "remoteComponent", "10ns") )
@@ -50,9 +50,18 @@ class testcase_Component(SSTTestCase):
 
 #####
 
+    have_mpi = sst_core_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", default=0, disable_warning=True) == 1
+
     def test_Component(self):
         self.component_test_template("component")
 
+    def test_Component_staggered_exit_thread_neighbor(self):
+        self.staggered_exit_test_template("thread_neighbor", "--thread-sync-neighbor")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_Component_staggered_exit_rank_neighbor(self):
+        self.staggered_exit_test_template("rank_neighbor", "--rank-sync-neighbor", num_ranks=3, num_threads=1)
+
 #####
 
     def component_test_template(self, testtype):
@@ -69,3 +78,19 @@ class testcase_Component(SSTTestCase):
         cmp_result = testing_compare_sorted_diff(testtype, outfile, reffile)
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile, reffile))
 
+    def staggered_exit_test_template(self, testtype, extra_args, num_ranks=1, num_threads=2):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_StaggeredExit.py".format(testsuitedir)
+        outfile_ref = "{0}/test_StaggeredExit_ref.out".format(outdir)
+        outfile_check = "{0}/test_StaggeredExit_{1}.out".format(outdir, testtype)
+
+        # Every thread and rank has to run up to the end time, so the output
+        # must match a serial run
+        self.run_sst(sdlfile, outfile_ref, num_ranks=1, num_threads=1)
+        self.run_sst(sdlfile, outfile_check, other_args=extra_args, num_ranks=num_ranks, num_threads=num_threads)
+
+        # Perform the test
+        cmp_result = testing_compare_sorted_diff(testtype, outfile_check, outfile_ref)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_check, outfile_ref))
@@ -50,6 +50,8 @@ class testcase_Links(SSTTestCase):
 
 #####
 
+    have_mpi = sst_core_config_include_file_get_value_int("SST_CONFIG_HAVE_MPI", default=0, disable_warning=True) == 1
+
     def test_Links(self):
         self.component_test_template("basic")
 
@@ -59,9 +61,36 @@ class testcase_Links(SSTTestCase):
     def test_Links_wrong_port(self):
         self.component_test_template("wrong_port", "--model-options=wrong_port", 1)
 
+    def test_Links_batch(self):
+        self.component_test_template("basic", "--model-options=batch", variant="batch")
+
+    def test_Links_batch_threads(self):
+        self.component_test_template("basic", "--model-options=batch", num_threads=2, variant="batch")
+
+    def test_Links_mempool_reclaim(self):
+        self.component_test_template("basic", "--model-options=batch --mempool-reclaim", num_threads=2, variant="mempool_reclaim")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_Links_overlap(self):
+        self.component_test_template("basic", "--rank-sync-overlap", num_ranks=2, variant="overlap")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_Links_neighbor(self):
+        self.component_test_template("basic", "--rank-sync-neighbor", num_ranks=2, variant="neighbor")
+
+    @unittest.skipIf(not have_mpi, "MPI is not included as part of this build")
+    def test_Links_shmem(self):
+        self.component_test_template("basic", "--rank-sync-shmem", num_ranks=2, variant="shmem")
+
+    def test_Links_thread_neighbor(self):
+        self.component_test_template("basic", "--thread-sync-neighbor", num_threads=2, variant="thread_neighbor")
+
+    def test_Links_hybrid_barrier(self):
+        self.component_test_template("basic", "--barrier-mode=hybrid", num_threads=2, variant="hybrid_barrier")
+
 #####
 
-    def component_test_template(self, testtype, extra_args="", rc=0):
+    def component_test_template(self, testtype, extra_args="", rc=0, num_threads=None, variant=None, num_ranks=None):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
@@ -69,9 +98,13 @@ class testcase_Links(SSTTestCase):
         else: ext = "err"
         sdlfile = "{0}/test_Links.py".format(testsuitedir)
         reffile = "{0}/refFiles/test_Links_{1}.out".format(testsuitedir,testtype)
-        outfile = "{0}/test_Links_{1}.{2}".format(outdir,testtype,ext)
+        outname = testtype
+        if num_ranks is not None: outname = "{0}_{1}ranks".format(outname,num_ranks)
+        if num_threads is not None: outname = "{0}_{1}threads".format(outname,num_threads)
+        if variant is not None: outname = "{0}_{1}".format(outname,variant)
+        outfile = "{0}/test_Links_{1}.{2}".format(outdir,outname,ext)
 
-        self.run_sst(sdlfile, outfile, other_args=extra_args, expected_rc=rc)
+        self.run_sst(sdlfile, outfile, other_args=extra_args, expected_rc=rc, num_ranks=num_ranks, num_threads=num_threads)
 
         # Perform the test
         filter1 = StartsWithFilter("WARNING: No components are")
@@ -11,6 +11,7 @@
 # information, see the LICENSE file in the top level directory of the
 # distribution.
 
+import json
 import os
 import sys
 
@@ -35,6 +36,15 @@ def initializeTestModule_SingleInstance(class_inst):
 
 ################################################################################
 
+def latency_in_ps(latency):
+    """Convert a latency from the partition report, such as "1.5 ns", to ps"""
+    if latency == "none":
+        return float("inf")
+    value, units = latency.split()
+    return float(value) * {"s": 1e12, "ms": 1e9, "us": 1e6, "ns": 1e3, "ps": 1.0, "fs": 1e-3}[units]
+
+################################################################################
+
 class testcase_Partitioners(SSTTestCase):
 
     def initializeClass(self, testName):
@@ -63,23 +73,125 @@ class testcase_Partitioners(SSTTestCase):
     def test_simple(self):
         self.partitioner_test_template("simple", "6 6", "sst.simple")
 
+    def test_multilevel(self):
+        report = self.partitioner_test_template("multilevel", "12 12", "sst.multilevel", num_threads=4)
+        self.assert_report_counts(report, 144, 288)
+        self.assert_balanced(report, 1.05)
+
+    def test_lookahead(self):
+        report = self.partitioner_test_template("lookahead", "10 10 latencies", "sst.lookahead", num_threads=4)
+
+        # The smallest link latency is 1ns, so the threshold search
+        # should find a larger lookahead without giving up the balance
+        self.assert_balanced(report, 1.05)
+        self.assertGreater(latency_in_ps(report["min_part"]), 1000)
+        self.assertGreater(latency_in_ps(report["min_thread_part"]), 1000)
+
+    def test_geometric(self):
+        report = self.partitioner_test_template("geometric", "12 12 coords", "sst.geometric", num_ranks=1, num_threads=4)
+
+        # Recursive coordinate bisection cuts the 12x12 torus into four
+        # 6x6 quadrants: 24 links across each of the two cut lines in x,
+        # and 12 across each of the cut lines in y in each half
+        self.assert_report_counts(report, 144, 288)
+        self.assert_balanced(report, 1.0)
+        self.assertEqual(report["links"]["cut_between_ranks"] + report["links"]["cut_between_threads"], 48)
+
+    def test_hierarchical(self):
+        report = self.partitioner_test_template("hierarchical", "12 12", "sst.hierarchical", num_threads=4)
+        self.assert_report_counts(report, 144, 288)
+        self.assert_balanced(report, 1.05)
+
+    @unittest.skipIf(not host_os_is_linux(), "Thread binding is only supported on Linux")
+    def test_hierarchical_numa_binding(self):
+        report = self.partitioner_test_template("hierarchical_numa_binding", "12 12", "sst.hierarchical", "--thread-numa-binding", num_threads=4)
+        self.assert_report_counts(report, 144, 288)
+        self.assert_balanced(report, 1.05)
+
+        # Every thread should have been bound to the CPUs of its domain
+        outfile_check = "{0}/test_partitioner_check_hierarchical_numa_binding.out".format(test_output_get_run_dir())
+        with open(outfile_check) as f:
+            output = f.read()
+        self.assertNotIn("Unable to bind thread", output)
+        self.assertNotIn("NUMA layout not available", output)
+        self.assertNotIn("usable NUMA domains", output)
+
+    def test_profile_weights(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Profile a serial run, then partition using the profile
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile_profile = "{0}/test_partitioner_profile_weights_run.out".format(outdir)
+        profile = "{0}/test_partitioner_profile_weights.prof".format(outdir)
+        options = "--model-options=\"10 10\" --enable-profiling=\"event:sst.profile.handler.event.partition;clock:sst.profile.handler.clock.partition\" --profiling-output={0}".format(profile)
+        self.run_sst(sdlfile, outfile_profile, other_args=options, num_ranks=1, num_threads=1)
+
+        report = self.partitioner_test_template("profile_weights", "10 10", "sst.multilevel", "--partition-weights={0}".format(profile), num_threads=2)
+
+        # The parts are balanced by the measured handler times, not by
+        # the number of components.  The times vary from run to run, so
+        # allow more imbalance than the partitioner aims for.
+        weights = [part["weight"] for part in report["parts"]]
+        self.assertTrue(any(abs(w - round(w)) > 1e-6 for w in weights), "Part weights {0} are component counts".format(weights))
+        self.assert_balanced(report, 1.1)
+
+    def test_partition_report(self):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile = "{0}/test_partitioner_report.out".format(outdir)
+        reportfile = "{0}/test_partitioner_report.json".format(outdir)
+        options = "--model-options=\"6 6\" --partitioner=sst.multilevel --output-partition-report={0}".format(reportfile)
+        self.run_sst(sdlfile, outfile, other_args=options, num_ranks=1, num_threads=2)
+
+        # Check that the report accounts for every component and link
+        with open(reportfile) as f:
+            report = json.load(f)
+        self.assertEqual(len(report["parts"]), 2)
+        self.assertEqual(sum(part["components"] for part in report["parts"]), 36)
+        self.assertEqual(report["links"]["total"], 72)
+        cut = report["links"]["cut_between_ranks"] + report["links"]["cut_between_threads"]
+        self.assertEqual(sum(part["cut_links"] for part in report["parts"]), 2 * cut)
+        self.assertEqual(sum(x["between_ranks"] + x["between_threads"] for x in report["cut_latencies"]), cut)
+
 #####
 
-    def partitioner_test_template(self, testtype, model_options, partitioner):
+    def assert_report_counts(self, report, num_components, num_links):
+        self.assertEqual(sum(part["components"] for part in report["parts"]), num_components)
+        self.assertEqual(report["links"]["total"], num_links)
+        cut = report["links"]["cut_between_ranks"] + report["links"]["cut_between_threads"]
+        self.assertEqual(sum(part["cut_links"] for part in report["parts"]), 2 * cut)
+        self.assertEqual(sum(x["between_ranks"] + x["between_threads"] for x in report["cut_latencies"]), cut)
+
+    def assert_balanced(self, report, tolerance):
+        weights = [part["weight"] for part in report["parts"]]
+        mean = sum(weights) / len(weights)
+        self.assertLessEqual(max(weights), tolerance * mean, "Partition is not balanced: part weights {0}".format(weights))
+
+    def partitioner_test_template(self, testtype, model_options, partitioner, extra_options = "", num_ranks = None, num_threads = None):
         testsuitedir = self.get_testsuite_dir()
         outdir = test_output_get_run_dir()
 
-        options = "--model-options=\"{0}\" --partitioner={1}".format(model_options, partitioner);
+        options = "--model-options=\"{0}\" --partitioner={1} {2}".format(model_options, partitioner, extra_options);
         
         # Set the various file paths
         sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
         outfile_ref = "{0}/test_partitioner_ref_{1}.out".format(outdir, testtype)
         outfile_check = "{0}/test_partitioner_check_{1}.out".format(outdir, testtype)
+        reportfile = "{0}/test_partitioner_report_{1}.json".format(outdir, testtype)
 
         # Do a serial reference run
         self.run_sst(sdlfile, outfile_ref, other_args=options, num_ranks=1, num_threads=1)
-        self.run_sst(sdlfile, outfile_check, other_args=options)
+        check_options = "{0} --output-partition-report={1}".format(options, reportfile)
+        self.run_sst(sdlfile, outfile_check, other_args=check_options, num_ranks=num_ranks, num_threads=num_threads)
 
-        # Perform the test
-        cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        # Perform the test, leaving out the partition report summary
+        report_filter = StartsWithFilter("#")
+        cmp_result = testing_compare_filtered_diff(testtype, outfile_ref, outfile_check, sort=True, filters=[report_filter])
         self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))
+
+        # Return the partition report of the check run
+        with open(reportfile) as f:
+            return json.load(f)
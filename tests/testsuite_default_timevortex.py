@@ -0,0 +1,118 @@
+# -*- coding: utf-8 -*-
+#
+# Copyright 2009-2022 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2022, NTESS
+# All rights reserved.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import os
+import sys
+
+from sst_unittest import *
+from sst_unittest_support import *
+
+################################################################################
+# Code to support a single instance module initialize, must be called setUp method
+
+module_init = 0
+module_sema = threading.Semaphore()
+
+def initializeTestModule_SingleInstance(class_inst):
+    global module_init
+    global module_sema
+
+    module_sema.acquire()
+    if module_init != 1:
+        # Put your single instance Init Code Here
+        module_init = 1
+    module_sema.release()
+
+
+class testcase_TimeVortex(SSTTestCase):
+
+    def initializeClass(self, testName):
+        super(type(self), self).initializeClass(testName)
+        # Put test based setup code here. it is called before testing starts
+        # NOTE: This method is called once for every test
+
+    def setUp(self):
+        super(type(self), self).setUp()
+        initializeTestModule_SingleInstance(self)
+        # Put test based setup code here. it is called once before every test
+
+    def tearDown(self):
+        # Put test based teardown code here. it is called once after every test
+        super(type(self), self).tearDown()
+
+###
+
+
+    def test_dary_heap(self):
+        self.timevortex_test_template("dary_heap", "sst.timevortex.dary_heap", serial=True)
+
+    def test_dary_heap_interthread(self):
+        self.timevortex_test_template("dary_heap_interthread", "sst.timevortex.dary_heap", 2, "--interthread-links")
+
+    def test_ladder(self):
+        self.timevortex_test_template("ladder", "sst.timevortex.ladder", serial=True)
+
+    def test_ladder_interthread(self):
+        self.timevortex_test_template("ladder_interthread", "sst.timevortex.ladder", 2, "--interthread-links")
+
+    def test_adaptive(self):
+        self.timevortex_test_template("adaptive", "sst.timevortex.adaptive", serial=True)
+
+    # Check at every pop with thresholds that force a switch at the
+    # first check, so the contents are migrated in each direction.
+    # The switch must not change the order the events come out in.
+    def test_adaptive_to_calendar(self):
+        self.timevortex_test_template("adaptive_to_calendar", "sst.timevortex.adaptive(initial=heap,calendar_depth=1,heap_depth=0,check_interval=1)", serial=True)
+
+    def test_adaptive_to_heap(self):
+        self.timevortex_test_template("adaptive_to_heap", "sst.timevortex.adaptive(initial=calendar,calendar_depth=1000001,heap_depth=1000000,check_interval=1)", serial=True)
+
+    def test_adaptive_interthread(self):
+        self.timevortex_test_template("adaptive_interthread", "sst.timevortex.adaptive", 2, "--interthread-links")
+
+    def test_inbox_interthread(self):
+        self.timevortex_test_template("inbox_interthread", "sst.timevortex.priority_queue", 2, "--interthread-links --interthread-inbox")
+
+    def test_inbox_ladder_interthread(self):
+        self.timevortex_test_template("inbox_ladder_interthread", "sst.timevortex.ladder", 2, "--interthread-links --interthread-inbox")
+
+#####
+
+    def timevortex_test_template(self, testtype, timevortex, num_threads=None, extra_args="", serial=False):
+        testsuitedir = self.get_testsuite_dir()
+        outdir = test_output_get_run_dir()
+
+        # Serial runs must match the default TimeVortex exactly.  They
+        # use a model with a different link latency on each router,
+        # which spreads out the delivery times enough that the ladder
+        # has to spawn rungs.
+        if serial: model_options = "--model-options=\"10 10 latencies\""
+        else: model_options = "--model-options=\"6 6\""
+        options = "{0} --timeVortex=\"{1}\" {2}".format(model_options, timevortex, extra_args)
+
+        # Set the various file paths
+        sdlfile = "{0}/test_MessageMesh.py".format(testsuitedir)
+        outfile_ref = "{0}/test_timevortex_ref_{1}.out".format(outdir, testtype)
+        outfile_check = "{0}/test_timevortex_check_{1}.out".format(outdir, testtype)
+
+        # Do a serial reference run with the default TimeVortex
+        self.run_sst(sdlfile, outfile_ref, other_args=model_options, num_ranks=1, num_threads=1)
+
+        # Perform the test
+        if serial:
+            self.run_sst(sdlfile, outfile_check, other_args=options, num_ranks=1, num_threads=1)
+            cmp_result = testing_compare_diff(testtype, outfile_ref, outfile_check)
+        else:
+            self.run_sst(sdlfile, outfile_check, other_args=options, num_threads=num_threads)
+            cmp_result = testing_compare_sorted_diff(testtype, outfile_ref, outfile_check)
+        self.assertTrue(cmp_result, "Output/Compare file {0} does not match Reference File {1}".format(outfile_ref, outfile_check))